@@ -0,0 +1,45 @@
+### MBR min-bias event library with cdfGen
+# 1) write the library: one interaction per record, MBR runs as usual
+#      MBR_LIBRARY_MODE=write cdfGen mbr_library.tcl
+# 2) overlay: every pile-up interaction is a random library event,
+#    rotated in phi and given a new z vertex, no MBR call
+#      MBR_LIBRARY_MODE=read  cdfGen mbr_library.tcl
+# The same MinBiasLibraryMenu exists in PythiaMinBias and MixFakeEv.
+#
+if [ file exists $env(SRT_PRIVATE_CONTEXT)/TclUtils ] { 
+  source $env(SRT_PRIVATE_CONTEXT)/TclUtils/scripts/getenv.tcl
+} else { 
+  source $env(SRT_PUBLIC_CONTEXT)/TclUtils/scripts/getenv.tcl
+}
+set libraryMode [ getenv MBR_LIBRARY_MODE "write" ]
+set libraryFile [ getenv MBR_LIBRARY_FILE "mbr_library.gcache" ]
+
+path enable AllPath
+module input GenInputManager
+
+mod enable mbr
+mod talk mbr
+  pbeam set 980
+  process set 11
+  MinBiasLibraryMenu
+    if { $libraryMode == "write" } {
+      writeFile set $libraryFile
+    } else {
+      readFile  set $libraryFile
+      rotatePhi set true
+      zSigma    set 280.
+    }
+  exit
+  if { $libraryMode == "read" } {
+    MODE set POISSON
+    MEAN set 6.
+  }
+exit
+
+if { $libraryMode == "write" } {
+  begin -nev 100000
+} else {
+  begin -nev 1000
+}
+
+exit
@@ -0,0 +1,33 @@
+# run with cdfGen
+# MIX_FAKE_EVENT with particle recipes: a jet-like spray of pions in a
+# 0.2 cone around a random axis plus two isolated CDFCODE 11 particles.
+# Each recipe generates all its particles at once, CdfCode/NPARTICLES
+# are ignored as soon as one recipe is given.
+#
+# recipe CDFCODE N [FIXED|POISSON [cone [histFile]]]
+#   histFile: GenHistSampler text file, x = PT (or P) bin edges,
+#             y = ETA (or THETA) bin edges, w = cell weights;
+#             y is the eta distance from the axis when cone > 0
+
+path enable AllPath
+
+module input GenInputManager
+
+module enable MIX_FAKE_EVENT
+talk MIX_FAKE_EVENT
+    use PT
+    use ETA
+# generate PARAMETER_NAME MEAN SIGMA PMIN PMAX POWER MODE(1=gauss,2=flat)
+# PT is used for recipes without histogram, ETA and PHI for the axis
+    generate PT      0. 0.   1.    20.  -2.  2
+    generate ETA     0. 0.  -1.0   1.0   0.  2
+    generate PHI     0. 0.   0.0   360.  0.  2
+    recipe  401 10. POISSON 0.2
+    recipe -401 10. POISSON 0.2
+    recipe  11   2  FIXED
+    show
+exit
+
+begin -nev 1000
+
+exit
@@ -11,7 +11,11 @@
 //      -inits HEPEVT for derived class
 //      -inits rn stream for derived class
 //      -manages multiple primary interactions generation
-//        ( FIXEDMODE/POISSONMODE options )  
+//        ( FIXEDMODE/POISSONMODE/TRUNCPOISSON/PROFILEMODE options,
+//          sampled from a table built at beginRun, see PileupSampler )
+//      -optional generator level acceptance (GenAcceptanceMenu):
+//        failing events are regenerated before being stored
+//      -optional per phase timing (TIMING, TIMING_FILE talk-to's)
 //
 // created July 27 2001, Elena Gerchtein (CMU)
 //       
@@ -25,11 +29,17 @@
 #include "Framework/AbsParmEnum.hh"
 #include "Framework/AbsParmGeneral.hh"
 #include "FrameMods/HepHistModule.hh"
+#include "HepTuple/HepHist1D.h"
 #include "stdhep_i/CdfHepEvt.hh"
+#include "generatorMods/GenAcceptanceMenu.hh"
+#include "generatorMods/PileupSampler.hh"
+#include "generatorMods/GenTiming.hh"
 #include <vector>
 #include <string>
+#include <map>
 
 class HepRandomEngine;
+class HepevtPool;
 
 class AbsGenModule : public HepHistModule {
 
@@ -74,6 +84,7 @@ protected:
   static int const FIXEDMODE;
   static int const POISSONMODE;
   static int const TRUNCPOISSON;
+  static int const PROFILEMODE;
 					// defines whether fixed or 
 					// Poisson-distributed number of events
 					// will be generated 
@@ -84,19 +95,58 @@ protected:
 					// mean number of events to be generated
                                         // per call (default = 1)
   AbsParmGeneral<double> _mean;
+					// (run, weight, mean) table used in
+					// PROFILE mode
+  AbsParmGeneral<std::string> _profileFile;
+					// multiplicity table for current run
+  PileupSampler          _multiplicity;
   void                   _initStdhepLun(int lun);
 
   // Subclasses should only override this if they provide new output methods
   virtual int outputEvent(AbsEvent* event); 
 
+					// histogram handles: resolve the title
+					// once, then fill by index
+  typedef int HistHandle;
+  HistHandle histHandle(const std::string& title,
+			const int& nbins,
+			const float& low,
+			const float& high);
+  void fill(HistHandle h, const float& var, float weight=1) {
+    _hists[h]->accumulate(var,weight);
+  }
+
+					// books on first use, same as
+					// fill(histHandle(...),var,weight)
   void Plot(const std::string&, 
 	    const float& var, 
 	    const int& nbins, 
 	    const float& low, 
 	    const float& high, float weight=1);
   
+					// generator level cuts applied on
+					// /HEPEVT/ before the event is stored
+  GenAcceptanceMenu      _acceptance;
+
+					// phase timing, TIMING talk-to
+  AbsParmBool            _timingParm;
+  AbsParmGeneral<std::string> _timingFile;
+  bool                   _timingOn;
+  GenTiming              _timing;
+					// for retry loops inside derived
+					// modules: ntries calls of "loop"
+  void countRetries(const char* loop, long ntries) {
+    if ( _timingOn ) _timing.countRetries(loop,ntries);
+  }
+
+					// recycled Hepevt storage for the
+					// sub-events pushed to CdfHepevt
+  HepevtPool*            _hepevtPool;
+
 private:
-  std::vector<HepObj*> _histList;
+  std::vector<HepHist1D*>           _hists;
+  std::map<std::string, HistHandle> _histIndex;
+  HistHandle                        _hNevents;
 };
 
 #endif
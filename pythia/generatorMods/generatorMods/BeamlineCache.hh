@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Local run -> beamline cache for GenPrimVertModule
+//
+//   Lets the DB beamline option run without the database: the beamline
+//   of every run is looked up by binary search in a sorted file of
+//   fixed size records, the last runs asked for are kept in a small
+//   LRU list.
+//
+//   The file is made once: GenPrimVertModule with BeamlineFromDB and
+//   BeamlineDumpFile set writes the beamlines it reads from the DB as
+//   text lines
+//     run  source  x  y  z  dx/dz  dy/dz  sigma_z  sigma_x  sigma_y
+//   (source 1 SVX, 2 COT; dumps without the last two columns are read
+//   with zero x and y widths) and makeBeamlineCache sorts them into the
+//   binary file: the 8 characters "BMLCACH2", int32 record count, int32
+//   record size, then Entry records sorted by run.  A text file is also
+//   accepted as is.
+//
+//----------------------------------------------------------------------------
+#ifndef BEAMLINECACHE_HH__
+#define BEAMLINECACHE_HH__
+
+#include <stdio.h>
+#include <list>
+#include <string>
+#include <vector>
+
+class BeamlineCache {
+
+public:
+
+  enum { SVX = 1, COT = 2 };
+  enum { LRUSIZE = 16 };
+
+  struct Entry {
+    int    run;
+    int    source;
+    double x, y, z;
+    double dxdz, dydz;
+    double sigmaZ;
+    double sigmaX, sigmaY;            // 0 where the DB has no widths
+  };
+
+  BeamlineCache();
+  ~BeamlineCache();
+					// ****** operations
+  int    open (const std::string& fileName);
+  void   close();
+					// copies the beamline of run to e,
+					// -1 if the run is not in the file
+  int    find (int run, Entry& e);
+
+  static int readText (const std::string& fileName, std::vector<Entry>& e);
+					// by run, the last of repeated runs
+  static void sort    (std::vector<Entry>& e);
+  static int writeFile(const std::string& fileName, const std::vector<Entry>& e);
+  static void writeText(FILE* f, const Entry& e);
+
+    					// ****** access functions
+  long   size()      const { return _n; }
+  long   nLookups()  const { return _nLookups; }
+  long   nLruHits()  const { return _nLruHits; }
+  long   nFileReads() const { return _nReads; }
+
+private:
+
+  int    readEntry(long i, Entry& e);
+
+  FILE*               _file;          // binary file, or
+  std::vector<Entry>  _text;          // text file in memory
+  long                _n;
+  std::list<Entry>    _lru;           // most recent first
+  long                _nLookups;
+  long                _nLruHits;
+  long                _nReads;
+};
+
+#endif
@@ -30,6 +30,8 @@
 #include "Framework/AbsParmBool.hh"
 #include "Framework/AbsParmList.hh"
 #include "generatorMods/AbsGenModule.hh"
+#include "generatorMods/GenHistSampler.hh"
+#include <vector>
 
 class APPCommand;
 class APPMenu;
@@ -160,7 +162,26 @@ protected:
   AbsParmGeneral<int> _nbinPt;
   AbsParmList<double> _valPt;
   double generatePtUsingHist();
-  double _myValPt[200];
+  GenHistSampler _ptHist;       // usePtHist histogram
+  HistHandle _hPt;              // "pt" monitoring histogram
+
+  // Histogram file menu: 1D or 2D histogram of PT/P, ETA/THETA/Y,
+  // PHI read at beginRun, sampled with an alias table
+  APPMenu _HistMenu;
+  AbsParmGeneral<std::string> _histFile;
+  AbsParmGeneral<std::string> _histX;
+  AbsParmGeneral<std::string> _histY;
+  GenHistSampler _hist;
+  std::string    _histLoaded;
+  int  _histVarX, _histVarY;
+  void _initializeHistTalkTo(void);
+  int  _histVariable(const std::string& name) const;
+
+					// per event batches, one entry per
+					// particle
+  std::vector<double> _bCode, _bMass, _bPolar, _bPhi, _bMom;
+  std::vector<double> _bHistX, _bHistY;
+  void generateValues(const GenPars& pars, int n, double* out) const;
 
   void _initializeRandomTalkTo(void);
   void _initializeUsePtHistTalkTo(void);
@@ -175,6 +196,7 @@ protected:
 
 public:
   static const char* genId;
+  static HepRandomEngine* fakeEvEngine;
 
   FakeEv();
   virtual    ~FakeEv( );
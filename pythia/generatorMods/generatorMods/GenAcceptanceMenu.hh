@@ -0,0 +1,94 @@
+//
+// GenAcceptanceMenu.hh - generator level acceptance predicate evaluated
+//                        directly on the /HEPEVT/ common, before the
+//                        event is copied or converted to HEPG;
+//                        talk-to's live in their own menu so that
+//                        any generator module can own one.
+//
+//   cuts (all optional, a cut is off at its default value):
+//     nLeptons       minimal number of e/mu with pt  > leptonPtMin
+//                    and |eta| < leptonEtaMax
+//     requirePdg     |IDHEP| that has to be present in the record
+//     visMassMin/Max window on the invariant mass of the visible
+//                    (non-neutrino) particles with |eta| < visEtaMax
+//     status         ISTHEP of the particles looked at, 0 = all
+//
+//   counts tries and accepted events; print() is called at endJob.
+//   Retry loops use decide(): once maxTries events in a row failed the
+//   last one is kept anyway and counted as forced only. The efficiency
+//   is that of the cuts, accepted/tries, and the accepted cross section
+//   is the generator one times it; forced events are outside the cuts
+//   and have to be dropped (or counted apart) by the analysis.
+//
+
+#ifndef GENACCEPTANCEMENU_HH
+#define GENACCEPTANCEMENU_HH
+
+#include <iosfwd>
+#include <string>
+
+#include "Framework/APPMenu.hh"
+#include "Framework/AbsParmGeneral.hh"
+
+#ifdef CDF
+#include "BaBar/Cdf.hh"
+#endif
+
+#include "ParticleDB/hepevt.hh"
+
+class GenAcceptanceMenu : public APPMenu {
+
+public:
+  enum Decision { REJECTED = 0, ACCEPTED, FORCED };
+
+  GenAcceptanceMenu ( AppModule* target=0,
+		      std::string menuName = "GenAcceptanceMenu",
+		      std::string title    = "Generator level acceptance" );
+  ~GenAcceptanceMenu() {}
+
+					// true if the event passes the cuts,
+					// always true when not enabled
+  bool   accept(const HEPEVT& hep);
+					// accept() for the try following
+					// nRejected rejected ones
+  Decision decide(const HEPEVT& hep, int nRejected);
+
+					// defaults set by a module's code
+  void   setEnabled   (bool on) { _enable.set(on); }
+  void   setRequirePdg(int id)  { _requirePdg.set(id); }
+  void   setMaxTries  (int n)   { _maxTries.set(n); }
+
+  bool   enabled()   const { return _enable.value(); }
+  int    maxTries()  const { return _maxTries.value(); }
+  long   nTries()    const { return _nTries; }
+  long   nAccepted() const { return _nAccepted; }
+  long   nForced()   const { return _nForced; }
+					// forced events excluded
+  double efficiency() const {
+    return _nTries ? double(_nAccepted)/_nTries : 0.;
+  }
+
+  void   print(std::ostream& os, const char* who) const;
+
+private:
+
+  bool   pass(const HEPEVT& hep) const;
+
+  AbsParmGeneral<bool>    _enable;
+  AbsParmGeneral<int>     _status;
+  AbsParmGeneral<int>     _nLeptons;
+  AbsParmGeneral<double>  _leptonPtMin;
+  AbsParmGeneral<double>  _leptonEtaMax;
+  AbsParmGeneral<int>     _requirePdg;
+  AbsParmGeneral<double>  _visMassMin;
+  AbsParmGeneral<double>  _visMassMax;
+  AbsParmGeneral<double>  _visEtaMax;
+  AbsParmGeneral<int>     _maxTries;
+
+  std::string _title;
+  long _nTries;
+  long _nAccepted;
+  long _nForced;
+};
+
+#endif // GENACCEPTANCEMENU_HH
@@ -0,0 +1,57 @@
+//--------------------------------------------------------------------------
+// Description:
+//      GenCacheInputModule: replays generator level events from a
+//      cache written by GenOutputManager (CacheFile talk-to)
+//
+//   Sits in the HardScatGenSequence in place of a generator: every
+//   event() reads one cached record and hands its interactions to
+//   GenOutputManager exactly as a generator would, so decay packages,
+//   GenPrimVertModule and simulation run unchanged downstream.
+//   With RestoreVertices the cached primary vertices are put in MVTX,
+//   so GenPrimVertModule keeps them instead of smearing new ones.
+//   With CheckLRIH a record whose run/event numbers differ from the
+//   LRIH GenInputManager made for the event is rejected.
+//   Unreadable records are skipped, the end of the cache stops the job.
+//
+//------------------------------------------------------------------------
+#ifndef GENCACHEINPUTMODULE_HH__
+#define GENCACHEINPUTMODULE_HH__
+
+class AbsEvent;
+
+#include "Framework/APPModule.hh"
+#include "Framework/AbsParmGeneral.hh"
+#include "BaBar/Cdf.hh"
+#include "generatorMods/GenEventCache.hh"
+#include <string>
+
+class GenCacheInputModule : public AppModule {
+
+public:
+
+  static const char* genId;
+
+  GenCacheInputModule( const char* const theName = "GenCacheInput",
+		       const char* const theDescription = 
+		       "Read generator level events from a GenEventCache file" );
+  virtual ~GenCacheInputModule();
+
+  virtual AppResult beginJob( AbsEvent* event );
+  virtual AppResult event   ( AbsEvent* event );
+  virtual AppResult endJob  ( AbsEvent* event );
+
+private:
+
+  GenEventCacheReader         _reader;
+  AbsParmGeneral<std::string> _fileName;
+  AbsParmGeneral<int>         _firstEvent;
+  AbsParmGeneral<bool>        _restoreVertices;
+  AbsParmGeneral<bool>        _checkLRIH;
+
+  long _events;
+  long _interactions;
+  long _badRecords;
+  long _lrihMismatches;
+};
+
+#endif
@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Batched Lorentz boost on structure-of-arrays four-momenta
+//
+//   The add_lorentz_boost of MinBiasModule applied to a range of
+//   momenta in one call, with no reference to /HEPEVT/ so that any
+//   generator module can use it. MinBiasModule::fragment_cluster
+//   boosts the whole cluster with it.
+//
+//     boost      Lorentz boost of a range of momenta, MBR convention
+//                beta[0..2] = velocity, beta[3] = gamma
+//
+//   Each momentum gets the same arithmetic as add_lorentz_boost, so
+//   the results are identical bit for bit.
+//
+//----------------------------------------------------------------------------
+#ifndef GENDECAYKERNEL_HH__
+#define GENDECAYKERNEL_HH__
+
+#include <vector>
+
+class GenDecayKernel {
+
+public:
+					// structure-of-arrays four-momenta
+  struct Momenta {
+    std::vector<double> px, py, pz, e;
+    void resize(int n) { px.resize(n); py.resize(n); pz.resize(n); e.resize(n); }
+    int  size() const  { return px.size(); }
+  };
+					// ****** operations
+
+					// momenta [first, first+n) of p
+  static void boost(const double beta[4], Momenta& p, int first, int n);
+};
+
+#endif
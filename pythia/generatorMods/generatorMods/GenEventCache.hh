@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Compact binary cache of generator level events
+//
+//   GenOutputManager (CacheFile talk-to) writes, for every event, the
+//   final /HEPEVT/ + /HEPEV4/ content of each primary interaction, i.e.
+//   what HEPG and HEP4 are made from, together with the primary vertices
+//   GenPrimVertModule puts in MVTX and the LRIH run and event numbers.
+//   GenCacheInputModule reads it back into /HEPEVT/ (and MVTX) so that
+//   the generator stage of a re-simulation is a file read, and checks
+//   the run and event numbers against the LRIH of the replaying job.
+//
+//   File layout (native byte order):
+//     header   "GENCACH1", int32 version, int32 sizeof(HEPEVT),
+//              int32 sizeof(HEPEV4)
+//     records  uint32 compressed length, uint32 raw length,
+//              zlib compressed event
+//     index    int64 offset of each record
+//     trailer  int64 number of events, int64 index offset, "GENCIDX1"
+//
+//   An event is int32 run, int32 event, int32 number of interactions,
+//   int32 number of vertices, then per interaction int32 NHEP, int32
+//   NEVHEP, the HEPEV4 scalars and the first NHEP rows of every
+//   per-particle array, then x, y, z [cm] and t [s] of every vertex.
+//   A file without trailer (job killed) is indexed by scanning it.
+//   Records which don't decode to exactly this layout, with NHEP in
+//   [0,NMXHEP], are rejected by readEvent().
+//
+//----------------------------------------------------------------------------
+#ifndef GENEVENTCACHE_HH__
+#define GENEVENTCACHE_HH__
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "ParticleDB/hepevt.hh"
+#include "stdhep_i/hepev4.hh"
+
+class GenEventCacheWriter {
+
+public:
+
+  GenEventCacheWriter();
+  ~GenEventCacheWriter();
+
+  int    open (const std::string& fileName, int compressionLevel = 6);
+  int    close();
+  bool   isOpen() const { return _file != 0; }
+
+					// one primary interaction of the
+					// current event
+  void   addInteraction(const HEPEVT& hep, const HEPEV4& hep4);
+					// its primary vertices, 4 numbers
+					// x, y, z, t per vertex
+  void   setVertices(int nv, const double* xyzt);
+					// its LRIH run and event numbers
+  void   setRunEvent(int run, int event);
+					// something added since writeEvent()
+  bool   pending() const { return _nInteractions > 0 || !_vertices.empty(); }
+					// closes the current event
+  int    writeEvent();
+
+  long   nEvents()    const { return _offsets.size(); }
+  double bytesRaw()   const { return _bytesRaw; }
+  double bytesDisk()  const { return _bytesDisk; }
+
+private:
+
+  FILE*                      _file;
+  std::vector<char>          _raw;
+  std::vector<unsigned char> _zbuf;
+  std::vector<long long>     _offsets;
+  std::vector<double>        _vertices;
+  int                        _run;
+  int                        _event;
+  int                        _nInteractions;
+  int                        _level;
+  double                     _bytesRaw;
+  double                     _bytesDisk;
+};
+
+class GenEventCacheReader {
+
+public:
+
+  GenEventCacheReader();
+  ~GenEventCacheReader();
+
+  int    open (const std::string& fileName);
+  void   close();
+
+  long   nEvents() const { return _offsets.size(); }
+
+					// reads event i (0 based) / the next
+					// one, returns 0 on success; readNext()
+					// moves on also past a bad record
+  int    readEvent(long i);
+  int    readNext() { return readEvent(_next++); }
+  void   seek(long i)  { _next = i; }
+  long   next()  const { return _next; }
+  bool   atEnd() const { return _next >= nEvents(); }
+
+  int    run()           const { return _run; }
+  int    event()         const { return _event; }
+  int    nInteractions() const { return _interactions.size(); }
+  int    nVertices()     const { return _nVertices; }
+
+					// copies interaction k of the current
+					// event into the commons
+  void   fillInteraction(int k, HEPEVT& hep, HEPEV4& hep4) const;
+					// x, y, z [cm], t [s] of vertex i
+  void   vertex(int i, double xyzt[4]) const;
+
+private:
+
+  int    scanRecords(long long start);
+
+  FILE*                      _file;
+  std::vector<long long>     _offsets;
+  std::vector<unsigned char> _zbuf;
+  std::vector<char>          _raw;
+  std::vector<size_t>        _interactions;   // offsets in _raw
+  size_t                     _vertexOffset;
+  int                        _nVertices;
+  long                       _next;
+  int                        _run;
+  int                        _event;
+};
+
+#endif
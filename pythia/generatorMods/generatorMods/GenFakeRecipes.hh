@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Fake events made of particle recipes
+//
+//   A recipe is a species, a fixed or Poisson multiplicity and its
+//   kinematics.  The event is made of all recipes; the particles of
+//   a recipe get their PT (or P) and ETA from a GenHistSampler file
+//   when one is given, else from the Kinematics of the owner (the
+//   MixFakeEv generate parameters).  cone > 0 correlates them in a
+//   gaussian (eta,phi) cone around an axis drawn once per recipe and
+//   event; with a 2D histogram y is then the eta distance from the
+//   axis.  Every variable of a recipe is drawn for all its particles
+//   at once, and the recipe is copied into /HEPEVT/ as one block of
+//   final state particles; the event is truncated at NMXHEP.
+//
+//----------------------------------------------------------------------------
+#ifndef GENFAKERECIPES_HH__
+#define GENFAKERECIPES_HH__
+
+#include <string>
+#include <vector>
+
+#include "ParticleDB/hepevt.hh"
+#include "generatorMods/GenHistSampler.hh"
+
+class HepRandomEngine;
+
+class GenFakeRecipes {
+
+public:
+					// pdgId and mass are filled by the
+					// owner from the particle database
+  struct Recipe {
+    int            cdfCode;
+    int            pdgId;
+    double         mass;
+    int            poisson;     // multiplicity: 0 fixed, 1 Poisson
+    double         mean;        // (mean) multiplicity
+    double         cone;        // cone width, 0 = no correlation
+    std::string    histFile;    // GenHistSampler text file
+    GenHistSampler hist;
+  };
+					// kinematics of the recipes without
+					// a histogram, n values per call
+  class Kinematics {
+  public:
+    virtual ~Kinematics() {}
+    virtual bool usePt   () const = 0;            // else P
+    virtual void momentum(int n, double* p) = 0;
+    virtual void polar   (int n, double* v) = 0;  // ETA or THETA
+    virtual void toEta   (int n, double* v) = 0;  // polar -> eta, in place
+    virtual void phi     (int n, double* v) = 0;  // radians
+  };
+
+  GenFakeRecipes() {}
+  ~GenFakeRecipes() {}
+					// ****** operations
+
+					// returns 0 on success
+  int     add     (int cdfCode, double mean, int poisson, double cone,
+		   const char* histFile);
+  void    clear   () { _recipes.clear(); }
+
+					// fills NHEP rows, returns 0
+  int     generate(HepRandomEngine* engine, Kinematics& kin, HEPEVT& hep);
+
+    					// ****** access functions
+  bool          empty()         const { return _recipes.empty(); }
+  int           size()          const { return _recipes.size(); }
+  Recipe&       recipe(int i)         { return _recipes[i]; }
+  const Recipe& recipe(int i)   const { return _recipes[i]; }
+
+private:
+
+  std::vector<Recipe> _recipes;
+					// reusable event buffers, one entry
+					// per particle of a recipe
+  std::vector<double> _bMom, _bEta, _bPhi, _bGaus, _bPhep;
+};
+
+#endif
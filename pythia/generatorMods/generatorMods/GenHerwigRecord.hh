@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Hard process row of a HERWIG event record after hwghep, shared by
+//      HerwigModule and the HERWIG shower of LesHouchesModule
+//
+//   index() scans /HEPEVT/ up to the first ISTHEP=123 row (the first
+//   outgoing parton of the hard process) and stops there. fillHepev4()
+//   then sets the /HEPEV4/ event weight and the pt of that parton
+//   (SCALELH(6)).
+//
+//   Rows are 0-based, -1 means "not present".
+//
+//----------------------------------------------------------------------------
+#ifndef GENHERWIGRECORD_HH__
+#define GENHERWIGRECORD_HH__
+
+#include "ParticleDB/hepevt.hh"
+#include "stdhep_i/hepev4.hh"
+
+class GenHerwigRecord {
+
+public:
+  enum { HARDPROCESS = 123 };		// first outgoing hard parton
+
+  GenHerwigRecord() : _nhep(0), _hardProcess(-1) {}
+					// ****** operations
+
+					// finds the first ISTHEP=123 row
+  void   index(const HEPEVT& hep);
+					// EVENTWEIGHTLH and SCALELH(6) = pt
+					// of the first ISTHEP=123 row
+  void   fillHepev4(const HEPEVT& hep, HEPEV4& hep4, double weight) const;
+
+					// ****** access functions
+  int    nhep () const { return _nhep; }
+  int    hardProcess() const { return _hardProcess; }
+  double pthat(const HEPEVT& hep) const;
+
+private:
+
+  int               _nhep;
+  int               _hardProcess;
+};
+
+#endif
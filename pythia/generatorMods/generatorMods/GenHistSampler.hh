@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Sampling of a 1D or 2D histogram with arbitrary binning
+//
+//   A cell is chosen in constant time with a Walker/Vose alias table,
+//   the point inside it is flat; two (1D) or three (2D) flat random
+//   numbers per sample, drawn with one shootArray per batch.
+//
+//   Text file, '#' starts a comment, keywords in any order:
+//     x  <nx+1 bin edges of the first variable>
+//     y  <ny+1 bin edges of the second variable>     (2D only)
+//     w  <nx (1D) or nx*ny (2D) non-negative weights>
+//   2D weights are given row by row, x running fastest (cell
+//   iy*nx+ix). Lines may be continued: all numbers after a keyword
+//   up to the next keyword belong to it.
+//
+//----------------------------------------------------------------------------
+#ifndef GENHISTSAMPLER_HH__
+#define GENHISTSAMPLER_HH__
+
+#include <string>
+#include <vector>
+
+class HepRandomEngine;
+
+class GenHistSampler {
+
+public:
+
+  GenHistSampler() {}
+  ~GenHistSampler() {}
+					// ****** operations
+
+					// yEdges empty for 1D, returns 0 on
+					// success
+  int    init (const std::vector<double>& xEdges,
+	       const std::vector<double>& yEdges,
+	       const std::vector<double>& weights);
+  int    read (const std::string& fileName);
+  void   clear();
+
+  int    cell (double u) const;         // alias lookup, u in [0,1)
+
+					// y is not touched for 1D; without
+					// a histogram (init failed or never
+					// called) the values are 0
+  void   shoot     (HepRandomEngine* engine, double& x, double& y);
+  void   shootArray(HepRandomEngine* engine, int n, double* x, double* y);
+					// x only: 1D, or the x marginal of
+					// a 2D histogram
+  void   shootArray(HepRandomEngine* engine, int n, double* x);
+
+    					// ****** access functions
+  bool   empty()             const { return _prob.empty(); }
+  int    dim()               const { return _yEdges.empty() ? 1 : 2; }
+  int    nCells()            const { return _prob.size(); }
+  int    nx()                const { return int(_xEdges.size()) - 1; }
+  double probability(int c)  const { return _norm[c]; }
+
+private:
+
+  std::vector<double> _xEdges;
+  std::vector<double> _yEdges;
+  std::vector<double> _norm;            // normalized cell weights
+  std::vector<double> _prob;            // alias table
+  std::vector<int>    _alias;
+  std::vector<double> _rn;
+					// y = 0: x only
+  void   fill(HepRandomEngine* engine, int n, double* x, double* y);
+};
+
+#endif
@@ -16,6 +16,8 @@ class AbsEvent;
 #include "Framework/AbsParmGeneral.hh"
 #include "BaBar/Cdf.hh" 
 #include "SimulationObjects/MCRunNumberFromLumi.hh"
+#include "generatorMods/RunLumiTable.hh"
+#include <string>
  
 class GenInputManager : public  APPGenInputModule {
 
@@ -35,6 +37,7 @@ public:
 private:
 
   void generateNewRunSection();
+  bool runsFromLumiTable();
 
   int  _eventNumber;
   AbsParmGeneral<int> _runSectionLength;
@@ -44,6 +47,16 @@ private:
 
   AbsParmBool _lumiWtRunsFromDB;
   MCRunNumberFromLumi _mcRun;
+
+  // local run -> luminosity table, replaces the DB when set; the runs
+  // are drawn from their own engine, not from SIMULATION
+  AbsParmGeneral<std::string> _lumiTableFile;
+  AbsParmGeneral<int>         _lumiTableEvents;
+  AbsParmGeneral<int>         _lumiTableFirstRun;
+  AbsParmGeneral<int>         _lumiTableLastRun;
+  AbsParmGeneral<long>        _lumiTableSeed1;
+  AbsParmGeneral<long>        _lumiTableSeed2;
+  RunLumiTable                _lumiTable;
   bool _initialized; // t after first beginRun
   
   // Create new LRIH bank and change run number from the LRIH in file input
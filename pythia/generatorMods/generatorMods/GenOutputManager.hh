@@ -10,8 +10,11 @@
 #define GENOUTPUTMANAGER_HH__
 
 class AbsEvent;
+class GenEventCacheWriter;
 
 #include "Framework/APPModule.hh"
+#include "Framework/AbsParmBool.hh"
+#include "Framework/AbsParmGeneral.hh"
 #include "BaBar/Cdf.hh" 
  
 class GenOutputManager : public  AppModule {
@@ -29,8 +32,30 @@ public:
   virtual AppResult   event   ( AbsEvent* event);
   virtual AppResult   abortJob( AbsEvent* event);
 
+  // true when StreamHepg is set (off by default) and no decay package
+  // or Tauola needs the list of Hepevt copies: generator modules then
+  // write HEPG/HEP4 for each primary interaction straight from /HEPEVT/
+  // with writeBanks(), which logs a bank it can't make or append like
+  // event() does and goes on with the next interaction
+  static bool         streamOutput() { return _streamOutput; }
+  static void         writeBanks( AbsEvent* event );
+
+  // event cache (CacheFile): GenPrimVertModule adds the MVTX vertices
+  // to the record of the current event, GenInputManager closes it when
+  // the next event starts
+  static void         cacheVertices( int nv, const double* xyzt );
+  static void         closeCacheEvent();
+
 private:
 
+  static bool _streamOutput;
+  AbsParmBool _streamParm;
+
+  // optional compact binary copy of every event, see GenEventCache.hh
+  static GenEventCacheWriter* _cache;
+  AbsParmGeneral<std::string> _cacheFile;
+  AbsParmGeneral<int>         _cacheCompression;
+
   //write HEPG bank if true
   bool _output;
   bool _stopIt;
@@ -27,6 +27,9 @@
 # include "Framework/AbsParmEnum.hh"
 # include "Framework/AbsParmGeneral.hh"
 # include "generatorMods/GendLdz.hh"
+# include "generatorMods/GenVertexSmearer.hh"
+# include "generatorMods/BeamlineCache.hh"
+# include <stdio.h>
 typedef AbsParmGeneral<long> AbsParmGeneral_long;
 
 class Beamline;
@@ -65,6 +68,9 @@ protected:
   AbsParmGeneral<bool> _useDB;
   AbsParmGeneral<bool> _useBetaStarWidth;
   AbsParmGeneral<bool> _useBetaStardLdz;
+  AbsParmGeneral<std::string> _betaStarZParmFile;
+  AbsParmGeneral<std::string> _beamlineCacheFile;
+  AbsParmGeneral<std::string> _beamlineDumpFile;
 
   // Random number menu
   APPMenu _randomNumberMenu;
@@ -83,9 +89,19 @@ protected:
   CotBeam* _cotBeam;
   Beamline* _beamline;
 
+  // local beamline file instead of the DB, and the DB dump that makes it
+  BeamlineCache* _beamlineCache;
+  FILE*          _beamlineDump;
+  // talk-to x/y widths, for the runs without widths in the DB or cache
+  float          _talkToSigmaX;
+  float          _talkToSigmaY;
+
   // betaStar z vertex simulation
   GendLdz* _zVtxGenerator;
 
+  // vertex generation with reused buffers
+  GenVertexSmearer _smearer;
+
 public:
 					// ****** constructors and destructor
 
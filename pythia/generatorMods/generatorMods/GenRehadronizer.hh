@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Event selection by repeated hadronisation of one parton level event
+//
+//   select() generates parton level events and hadronises each one up
+//   to nTries times until a try passes the selection (selectPdgCode of
+//   PythiaModule), then stops. Stopping at the first success favours
+//   parton configurations that pass often. In weighted mode all tries
+//   are made, the first selected one is kept and the event weight is
+//   (selected tries)/nTries. That weight is an unbiased estimate of the
+//   selection probability of the parton level event, so the weighted
+//   sample follows the distribution of a plain select-and-regenerate
+//   loop.
+//
+//   The generator side comes through the hooks: PythiaModule saves and
+//   restores /PYJETS/ and runs PYEXEC.
+//
+//----------------------------------------------------------------------------
+#ifndef GENREHADRONIZER_HH__
+#define GENREHADRONIZER_HH__
+
+class GenRehadronizer {
+
+public:
+
+  GenRehadronizer() : _nHard(0), _nExec(0), _nFound(0), _weight(1.) {}
+  virtual ~GenRehadronizer() {}
+					// ****** operations
+
+					// one selected event, returns its
+					// weight (1 unless weighted)
+  double select(int nTries, bool weighted);
+
+    					// ****** access functions
+					// of the last select()
+  long   nHard()  const { return _nHard; }
+  long   nExec()  const { return _nExec; }
+  int    nFound() const { return _nFound; }
+  double weight() const { return _weight; }
+
+protected:
+					// new hard process up to parton
+					// level, saved for the next tries
+  virtual void newPartonLevel()     = 0;
+  virtual void restorePartonLevel() = 0;
+					// true if the event passes
+  virtual bool hadronize()          = 0;
+  virtual void saveHadronLevel()    = 0;
+  virtual void restoreHadronLevel() = 0;
+
+private:
+
+  long   _nHard;
+  long   _nExec;
+  int    _nFound;
+  double _weight;
+};
+
+#endif
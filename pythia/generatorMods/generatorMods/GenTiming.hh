@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Per generator module timing and throughput accounting
+//
+//   AbsGenModule times the phases it drives (callGenerator, fillHepevt,
+//   the Hepevt copy) with gettimeofday and the getrusage user + system
+//   time, both to the microsecond; derived modules add their own retry
+//   loops through countRetries() (Pythia selectPdg, Herwig error
+//   retries, ...).
+//   At endJob the module prints events/s, tries per accepted event and
+//   the distribution of CPU time per event, and optionally writes the
+//   same numbers as "key value" lines to a summary file.
+//
+//   Nothing is measured unless the TIMING talk-to is set.
+//
+//----------------------------------------------------------------------------
+#ifndef GENTIMING_HH__
+#define GENTIMING_HH__
+
+#include <iosfwd>
+#include <map>
+#include <string>
+
+class GenTiming {
+
+public:
+
+  enum Phase { CALLGENERATOR = 0, FILLHEPEVT, HEPEVTCOPY, NPHASES };
+
+					// log2 bins of CPU time per event,
+					// bin 0 below 1 microsecond
+  enum { NCPUBINS = 32 };
+
+  GenTiming();
+  ~GenTiming() {}
+					// ****** operations
+  void   reset();
+
+  void   start(Phase p) { _t0[p] = wallTime(); _c0[p] = cpuTime(); }
+  void   stop (Phase p) {
+    _wall[p] += wallTime() - _t0[p];
+    _cpu [p] += cpuTime()  - _c0[p];
+    _calls[p]++;
+  }
+					// whole event, including the
+					// pile-up loop
+  void   startEvent() { _evWall0 = wallTime(); _evCpu0 = cpuTime(); }
+  void   stopEvent ();
+
+					// retry loop bookkeeping: ntries
+					// calls of the named loop
+  void   countRetries(const std::string& loop, long ntries);
+
+  void   print(std::ostream& os, const char* who) const;
+  int    writeSummary(const std::string& fileName, const char* who) const;
+
+  static double wallTime();             // seconds, CLOCK_MONOTONIC
+  static double cpuTime ();             // seconds, process CPU time
+
+    					// ****** access functions
+  long   nEvents()         const { return _nEvents; }
+  long   nCalls(Phase p)   const { return _calls[p]; }
+  double wall  (Phase p)   const { return _wall[p]; }
+  double cpu   (Phase p)   const { return _cpu[p]; }
+
+private:
+
+  static const char* phaseName(int p);
+
+  double _t0[NPHASES], _c0[NPHASES];
+  double _wall[NPHASES], _cpu[NPHASES];
+  long   _calls[NPHASES];
+
+  double _evWall0, _evCpu0;
+  double _evWall, _evCpu;
+  long   _nEvents;
+  long   _cpuHist[NCPUBINS];
+
+  std::map<std::string, long> _retryTries;
+  std::map<std::string, long> _retryCalls;
+};
+
+#endif
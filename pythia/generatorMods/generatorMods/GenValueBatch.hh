@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Array draws of the FakeEv / MixFakeEv generation parameters
+//
+//   FakeEv and MixFakeEv draw n values of a variable per event.
+//   A gaussian without range and a flat distribution each take one
+//   RandGaussT / RandFlat shootArray call here; the values are rounded
+//   to float, so they are the same numbers n calls of the module's
+//   generateValue give. For the other shapes shootArray returns false
+//   and the module draws the values one by one.
+//
+//----------------------------------------------------------------------------
+#ifndef GENVALUEBATCH_HH__
+#define GENVALUEBATCH_HH__
+
+class HepRandomEngine;
+
+class GenValueBatch {
+
+public:
+
+  enum Shape { GAUSSIAN, FLAT, OTHER };
+
+					// GAUSSIAN: mean, sigma, used only
+					// if sigma != 0 and min = max = 0;
+					// FLAT: [min,max)
+  static bool shootArray(HepRandomEngine* engine, Shape shape, int n,
+			 double* out, double mean, double sigma,
+			 double min, double max);
+};
+
+#endif
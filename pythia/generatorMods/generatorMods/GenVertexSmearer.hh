@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Batched primary vertex smearing for GenPrimVertModule
+//
+//   generate() fills x, y, z [cm] and t [s] of all primary vertices of
+//   an event in one pass over buffers that are kept between events and
+//   only grow, drawing the random numbers in the same order as the
+//   original per-vertex loop (bunch flats, 4 gaussians per vertex, then
+//   the betaStar z if GendLdz is used).
+//
+//   With the betaStar beam width the transverse sigmas are read from a
+//   z-grid table, built when the width parameters change, instead of a
+//   sqrt/pow per vertex:
+//     sigma(z) = sqrt( emittance * ( betaStar + (z - z0)^2 / betaStar ) )
+//
+//----------------------------------------------------------------------------
+#ifndef GENVERTEXSMEARER_HH__
+#define GENVERTEXSMEARER_HH__
+
+#include <vector>
+
+class HepRandomEngine;
+class GendLdz;
+
+class GenVertexSmearer {
+
+public:
+					// z range and step of the width table
+  static const double ZGRIDMIN;
+  static const double ZGRIDMAX;
+  static const double ZGRIDSTEP;
+
+  struct Beam {
+    double x0, y0, z0;                  // beam position [cm]
+    double dxdz, dydz;                  // beam slopes
+    double sigmaX, sigmaY, sigmaZ;      // [cm], sigmaX/Y without betaStar width
+    double sigmaT;                      // [ns]
+    int    nBunches;
+    double bunchSpacing;                // [ns]
+  };
+
+  struct BetaStarWidth {
+    double emittanceX, betaStarX, z0X;
+    double emittanceY, betaStarY, z0Y;
+  };
+
+  GenVertexSmearer();
+  ~GenVertexSmearer() {}
+					// ****** operations
+  void   setBeam(const Beam& beam) { _beam = beam; }
+					// 0 = no z dependent widths
+  void   setBetaStarWidth(const BetaStarWidth* width);
+					// 0 = gaussian z
+  void   setZGenerator(GendLdz* gen) { _zGen = gen; }
+
+					// returns 4*nv numbers x, y, z, t
+					// per vertex, valid until next call
+  const double* generate(HepRandomEngine* engine, int nv);
+
+					// transverse widths at z
+  void   widths(double z, double& sx, double& sy) const;
+  static double exactWidth(double emittance, double betaStar, double z0, double z);
+
+private:
+
+  Beam                _beam;
+  bool                _useWidth;
+  BetaStarWidth       _width;
+  std::vector<double> _sx, _sy;         // width table on the z grid
+  GendLdz*            _zGen;
+
+  std::vector<double> _grn;             // reused buffers
+  std::vector<double> _urn;
+  std::vector<double> _z;
+  std::vector<double> _out;
+};
+
+#endif
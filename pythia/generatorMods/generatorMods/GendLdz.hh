@@ -2,21 +2,29 @@
 // Description:  Class which facilitates generation of the primary 
 //               vertex z coordinate according to the betaStar dL/dz model.
 // Author:       Jason Galyardt
+//
+// The run range parameter sets are read from a data file, named by
+// setParmFile() or the GENDLDZ_PARM_FILE environment variable, on the
+// first getParms(); getParms() fails if it is missing or unreadable.
+// The binary form ("GDLDZ001", int32 number of bins, int32
+// sizeof(RunBin), then the RunBin records sorted by first run) is
+// mmap'd as is; a text file of "firstRun p0 p1 p2 p3 p4" lines is read
+// into memory.  makeGendLdzParms converts text to binary.  The ups
+// table points GENDLDZ_PARM_FILE at generatorMods/data/GendLdzParms.bin,
+// made from GendLdzParms.txt by generatorMods/data/GNUmakefile.
 
 #ifndef GendLdz_hh
 #define GendLdz_hh
 
 #include <iostream>
 #include <iomanip>
-#include <vector>
-#include <map>
 #include <algorithm>
+#include <vector>
+#include <string>
 #include <math.h>
 #include "r_n/CdfRn.hh"
 #include "CLHEP/Random/RandFlat.h"
 
-typedef std::map<int, std::vector<double>, std::greater<int> > parMap;
-
 // Forward class declarations
 class Beamline;
 class CotBeam;
@@ -25,51 +33,61 @@ class RandFlat;
 
 class GendLdz
 {
+public:
+  enum { NPARMS = 5 };
+  // cells of the tabulated dL/dz CDF over _dLdzRange, and of its guide
+  // table (first cell of each 1/NGUIDE slice of probability)
+  enum { NZCELLS = 4096, NGUIDE = 4096 };
+
+  // One run range of the dL/dz parameters: the range starts at firstRun
+  // and ends at the firstRun of the next bin.
+  // Parameters are ordered as follows,
+  // parms[0] -> amplitude (place holder)
+  // parms[1] -> z_min
+  // parms[2] -> sigma_z
+  // parms[3] -> z_0
+  // parms[4] -> betaStar
+  struct RunBin {
+    int    firstRun;
+    double parms[NPARMS];
+  };
+
 protected:
   bool _debug;
   static const double _dLdzRange[2];
   double _envHeight;
-  std::vector<double> _v;    // This is a dummy vector; should be empty
-  std::vector<double> _parms;
-  // The map containing the dL/dz parameters and their associated run numbers
-  parMap _dLdzMap;
+  const double* _parms;      // parameters of the current run, 0 if none
+
+  std::string _parmFile;
+  const RunBin* _bins;       // 0 until loadParms()
+  int _nBins;
   int _lastMapRun;
+  void* _map;                // mmap'd binary parameter file
+  size_t _mapSize;
+  std::vector<RunBin> _textBins;
+
+  // one entry cache of the last getParms() lookup
+  int _cachedRun;
+  const RunBin* _cachedBin;
+
+  // inverse CDF of the current run's dL/dz, rebuilt when the run's
+  // parameters change
+  std::vector<double> _cdf;   // NZCELLS+1 cumulative values, _cdf[0] = 0
+  std::vector<int>    _guide; // NGUIDE+1 cell indices
 
   // Member functions
-  int fillMap();
+  int loadParms();
+  int mapParmFile(const std::string& fileName);
+  const RunBin* findBin(int runNo) const;
+  void buildCdf();
+  double zOfU(double u) const;
+  void printBins() const;
   double dLdzFcn(const double &z) const;
   double findMax();
   // inline functions
   double sign(const double &a, const double &b);
   void shift(double &a, double &b, double &c, double &d);
 
-  // nested class
-  // Create a function object for use as a predicate 
-  // with the STL algorithm lower_bound()
-  class FindBin
-  {
-  public:
-    // overload operator()
-    bool operator()(const parMap::value_type val1, const parMap::value_type val2) const
-    {
-      return val1.first > val2.first;
-    }
-  };
-
-  // nested class
-  // Create a function object for use as a predicate
-  // with the STL algorithm min_element() (the default predicate is operator<, which
-  // looks at both the key and it's assocaited value, which we don't want.
-  class FindMinBin
-  {
-  public:
-    // overload operator()
-    bool operator()(const parMap::value_type val1, const parMap::value_type val2) const
-    {
-      return val1.first < val2.first;
-    }
-  };
-  
 public:
   // Constructors
   GendLdz();
@@ -77,10 +95,24 @@ public:
   // Destructor
   ~GendLdz();
   // Public member functions
+  void setParmFile(const std::string& fileName) { _parmFile = fileName; }
   int init();
   //  int getParms(const int &runNo);
   int getParms(const int &runNo, CotBeam* cotBeam);
+  // z sampled from the tabulated inverse CDF, one flat number each
   double throwZ(HepRandomEngine* engine);
+  void   throwZ(HepRandomEngine* engine, int n, double* out);
+  // the original von Neumann sampler, kept as the reference
+  double throwZAcceptReject(HepRandomEngine* engine);
+
+  // parameters of the current run and the table bounds (after getParms())
+  const double* parms() const { return _parms; }
+  int nBins() const { return _nBins; }
+  int lastRun() const { return _lastMapRun; }
+
+  // text parameter file <-> sorted bins, binary parameter file writer
+  static int readTextParms(const std::string& fileName, std::vector<RunBin>& bins);
+  static int writeParmFile(const std::string& fileName, const std::vector<RunBin>& bins);
 };
 
 #endif
@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Per-job pool of Hepevt objects used by AbsGenModule to store
+//      sub-events in CdfHepevt::contentHepevt()
+//
+//   Hepevt objects handed out by acquire() are filled from the /HEPEVT/
+//   and /HEPEV4/ commons copying only the first NHEP rows; objects
+//   returned by reclaim() (GenOutputManager, once the HEPG/HEP4 banks
+//   are written) are kept for the next event instead of being deleted.
+//   A new Hepevt is allocated only when the pool runs dry, so after the
+//   first few events a job reaches its high-water mark and stops
+//   allocating.
+//
+//----------------------------------------------------------------------------
+#ifndef HEPEVTPOOL_HH__
+#define HEPEVTPOOL_HH__
+
+#include <iosfwd>
+#include <list>
+#include <vector>
+#include <cstddef>
+
+#include "ParticleDB/hepevt.hh"
+#include "stdhep_i/hepev4.hh"
+
+class Hepevt;
+
+class HepevtPool {
+
+public:
+
+  static HepevtPool* Instance();
+
+  ~HepevtPool();
+					// ****** operations
+
+					// returns a Hepevt holding a copy of
+					// the first NHEP rows of the commons
+  Hepevt*  acquire(HEPEVT& hepevt, HEPEV4& hepev4);
+
+					// gives back a single Hepevt
+  void     release(Hepevt* cur) { if ( cur ) _free.push_back(cur); }
+
+					// moves all Hepevt objects of the list
+					// back to the pool, leaves list empty
+  void     reclaim(std::list<Hepevt*>& content);
+
+					// deletes all pooled objects
+  void     purge();
+
+					// copies the first nhep rows of the
+					// commons, returns number of bytes
+  static size_t copyRows(HEPEVT& to, HEPEV4& to4,
+			 const HEPEVT& from, const HEPEV4& from4);
+
+    					// ****** access functions
+  size_t   nAllocated  () const { return _nAllocated;  }
+  size_t   nAcquired   () const { return _nAcquired;   }
+  size_t   nRecycled   () const { return _nRecycled;   }
+  double   bytesCopied () const { return _bytesCopied; }
+  size_t   nFree       () const { return _free.size(); }
+
+  void     print(std::ostream& os) const;
+
+private:
+
+  HepevtPool();
+  HepevtPool(const HepevtPool&);
+  HepevtPool& operator=(const HepevtPool&);
+
+  static HepevtPool*    _instance;
+
+  std::vector<Hepevt*>  _free;
+  size_t                _nAllocated;
+  size_t                _nAcquired;
+  size_t                _nRecycled;
+  double                _bytesCopied;
+};
+
+#endif
@@ -23,6 +23,7 @@
 //      Feb 2004  add talkto variable for vers 6.504  jlys
 //      Feb 2005  add talkto variable for SOFTME  jdlee
 //      Oct 2004  add talkto variable for vers 6.505 Jimmy  jlys
+//      parton level veto before hadronisation (PartonAcceptanceMenu)
 //------------------------------------------------------------------------
 
 #ifndef HERWIGMODULE_HH 
@@ -37,6 +38,7 @@ class AppResult;
 class APPCommand;
 
 #include "generatorMods/AbsGenModule.hh"
+#include "generatorMods/GenHerwigRecord.hh"
 
 class HerwigModule : public AbsGenModule {
 
@@ -62,6 +64,9 @@ public:
 
 private:
   void InitializeTalkTo();
+				// true if the showered event fails
+				// the parton level acceptance
+  bool partonVeto(int nvetoed);
 
   APPMenu _01Menu;
   APPMenu _02Menu;
@@ -279,6 +284,15 @@ private:
   AbsParmGeneral<double> _jmrad73_Parm;// Jimmy prot radius inv-sq (H 6_505)
   AbsParmGeneral<double> _jmrad91_Parm;// Jimmy pbar radius inv-sq (H 6_505)
 
+				// parton level acceptance, evaluated after
+				// hwbgen/hwmsct/hwdhob, before hadronisation;
+				// refused with No_shower
+  GenAcceptanceMenu _partonAcceptance;
+  long _partonVetoes;
+
+				// index of the record after hwghep
+  GenHerwigRecord _herwigRecord;
+
   // event counter
   int _events;
 
@@ -472,7 +486,10 @@ private: // 2 private ct's
     _ptjim_Parm("Ptjim",this,2.5),
     _msflag_Parm("Msflag",this,1),
     _jmrad73_Parm("Jmrad73",this,0.71),
-    _jmrad91_Parm("Jmrad91",this,0.71)
+    _jmrad91_Parm("Jmrad91",this,0.71),
+    _partonAcceptance(this,"PartonAcceptanceMenu",
+		      "Parton level acceptance before hadronisation"),
+    _partonVetoes(0)
 
   {}
 
@@ -663,7 +680,10 @@ private: // 2 private ct's
      _ptjim_Parm("Ptjim",this,2.5),
      _msflag_Parm("Msflag",this,1),
      _jmrad73_Parm("Jmrad73",this,0.71),
-     _jmrad91_Parm("Jmrad91",this,0.71)
+     _jmrad91_Parm("Jmrad91",this,0.71),
+     _partonAcceptance(this,"PartonAcceptanceMenu",
+		       "Parton level acceptance before hadronisation"),
+     _partonVetoes(0)
 
 {}
 
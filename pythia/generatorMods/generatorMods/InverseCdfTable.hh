@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Tabulated inverse CDF for the MBR generator distributions
+//
+//   Holds the normalised cumulative integral of a density on the nodes
+//   x[0..n], built from the weights of the n cells, and inverts it with
+//   a binary search and linear interpolation inside the cell.  The
+//   arithmetic is that of the original MBR routines (S. Belforte), so
+//   for the same tables and random numbers the results are identical;
+//   only the linear search and the rebuild on every call are gone.
+//
+//----------------------------------------------------------------------------
+#ifndef INVERSECDFTABLE_HH__
+#define INVERSECDFTABLE_HH__
+
+#include <vector>
+
+class HepRandomEngine;
+
+class InverseCdfTable {
+
+public:
+
+  InverseCdfTable() {}
+  ~InverseCdfTable() {}
+					// ****** operations
+
+					// x: n+1 nodes, w: n cell weights
+  void   init(const std::vector<double>& x, const std::vector<double>& w);
+
+					// x at cumulative fraction u in (0,1]
+  double invert(double u) const;
+  double shoot (HepRandomEngine* engine) const;
+
+    					// ****** access functions
+  bool   empty()          const { return _f.empty(); }
+  int    cells()          const { return int(_f.size()) - 1; }
+  double node(int i)      const { return _x[i]; }
+  double cdf (int i)      const { return _f[i]; }
+
+private:
+
+  std::vector<double> _x;
+  std::vector<double> _f;
+};
+
+#endif
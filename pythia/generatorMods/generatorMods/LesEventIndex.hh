@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Byte offsets of the <event> blocks of a Les Houches event file,
+//      used by LesHouchesModule to start reading at firstEventToRead
+//      without parsing all preceding events
+//
+//   build() scans the file once, line by line, for "<event" tags at the
+//   beginning of a line and for the closing </LesHouchesEvents> tag.
+//   Given the last event a job needs it stops there, so a job starting
+//   at event 2 reads two events, not the whole file; such a partial
+//   index is not complete() and is never saved.
+//   The index is kept in a sidecar file (default: the event file name
+//   + ".idx", written by makeLesEventIndex or by a job which scanned
+//   the whole file) which is only used if size and modification time
+//   of the event file still match. write() goes through a temporary
+//   file renamed into place, so concurrent jobs never see a partial
+//   sidecar:
+//     the 8 characters "LESIDX01", then int64 file size, int64 mtime,
+//     int64 header end, int64 footer begin, int64 number of events and
+//     one int64 offset per event.
+//
+//   writeSlice() copies the header (everything up to the first event),
+//   a range of events and the footer into a new file, which the Fortran
+//   readers open in place of the full file. A partial index ends the
+//   slice with a plain </LesHouchesEvents> line.
+//   Offsets are off_t: generatorMods is built with _FILE_OFFSET_BITS=64
+//   (src and test/simple GNUmakefiles) for event files above 2 GB.
+//
+//----------------------------------------------------------------------------
+#ifndef LESEVENTINDEX_HH__
+#define LESEVENTINDEX_HH__
+
+#include <sys/types.h>
+#include <string>
+#include <vector>
+
+class LesEventIndex {
+
+public:
+
+  LesEventIndex() : _fileSize(0), _mtime(0), _headerEnd(0), _footer(0),
+		    _complete(false) {}
+  ~LesEventIndex() {}
+					// ****** operations
+
+					// all return 0 on success;
+					// last >= 0: stop once the offset of
+					// event last is known
+  int    build(const std::string& fileName, long last = -1);
+  int    read (const std::string& indexName, const std::string& fileName);
+					// complete indices only
+  int    write(const std::string& indexName) const;
+					// read() or build() + write(),
+					// an unwritable index is not an error
+  int    load (const std::string& fileName, std::string indexName = "",
+	       long last = -1);
+
+					// header, events [first,first+n)
+					// (n <= 0: up to the end), footer
+  int    writeSlice(const std::string& fileName, const std::string& sliceName,
+		    long first, long n = 0) const;
+
+					// default sidecar name
+  static std::string indexName(const std::string& fileName) {
+    return fileName + ".idx";
+  }
+					// line starts with "<tag" followed by
+					// '>', a blank or its end, possibly
+					// indented (also LesEventReader)
+  static bool isTag(const char* line, const char* tag);
+
+    					// ****** access functions
+  long   nEvents()       const { return _offsets.size(); }
+  off_t  offset (long i) const { return _offsets[i]; }
+  off_t  size   (long i) const {
+    return ( i+1 < nEvents() ? _offsets[i+1] : _footer ) - _offsets[i];
+  }
+  off_t  headerEnd()     const { return _headerEnd; }
+  off_t  footer()        const { return _footer; }
+  off_t  fileSize()      const { return _fileSize; }
+					// false if build() stopped early
+  bool   complete()      const { return _complete; }
+
+private:
+
+  int    stat (const std::string& fileName, off_t& size, time_t& mtime) const;
+
+  off_t              _fileSize;
+  time_t             _mtime;
+  off_t              _headerEnd;        // offset of the first event
+  off_t              _footer;           // end of the last event
+  bool               _complete;
+  std::vector<off_t> _offsets;
+};
+
+#endif
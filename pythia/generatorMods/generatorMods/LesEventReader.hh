@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Les Houches event file reader for LesHouchesModule (LesReader CXX)
+//
+//   Reads plain or gzip'd LHE files through zlib (gzread passes plain
+//   files through unchanged). open() reads the header and the <init>
+//   block; a background thread then decodes the <event> blocks into a
+//   bounded ring of queueSize events, so reading and decompression
+//   overlap with the shower of the previous events. read() takes the
+//   next event from the ring, blocking only if the thread is behind.
+//
+//   The ring slots are reused, so after the first queueSize events no
+//   memory is allocated. Parse errors found by the thread are reported
+//   by read(), i.e. in the job's thread.
+//
+//   While a reader is active() the UPINIT and UPEVNT calls of PYTHIA and
+//   HERWIG are served from it: the linker --wrap hooks in
+//   LesEventReader.cc (binaries linked with LES_READER_CXX=1) fill
+//   /HEPRUP/ and /HEPEUP/ instead of calling the Fortran readers (NUP = 0
+//   at the end of the file). hooked() tells whether UPINIT came here.
+//
+//----------------------------------------------------------------------------
+#ifndef LESEVENTREADER_HH__
+#define LESEVENTREADER_HH__
+
+#include <pthread.h>
+#include <sys/types.h>
+#include <string>
+#include <vector>
+
+					// /HEPRUP/ content
+struct LesInit {
+  int                 idbmup[2];
+  double              ebmup[2];
+  int                 pdfgup[2];
+  int                 pdfsup[2];
+  int                 idwtup;
+  std::vector<double> xsecup, xerrup, xmaxup;
+  std::vector<int>    lprup;
+};
+
+					// one line of an <event> block
+struct LesParticle {
+  int    idup, istup, mothup[2], icolup[2];
+  double pup[5], vtimup, spinup;
+};
+					// /HEPEUP/ content
+struct LesEvent {
+  int    idprup;
+  double xwgtup, scalup, aqedup, aqcdup;
+  std::vector<LesParticle> particles;
+};
+
+					// the Les Houches accord commons,
+					// defined by the Fortran libraries
+extern "C" {
+  enum { LES_MAXPUP = 100, LES_MAXNUP = 500 };
+  struct LesHeprup {
+    int    IDBMUP[2];
+    double EBMUP[2];
+    int    PDFGUP[2], PDFSUP[2], IDWTUP, NPRUP;
+    double XSECUP[LES_MAXPUP], XERRUP[LES_MAXPUP], XMAXUP[LES_MAXPUP];
+    int    LPRUP[LES_MAXPUP];
+  };
+  struct LesHepeup {
+    int    NUP, IDPRUP;
+    double XWGTUP, SCALUP, AQEDUP, AQCDUP;
+    int    IDUP[LES_MAXNUP], ISTUP[LES_MAXNUP];
+    int    MOTHUP[LES_MAXNUP][2], ICOLUP[LES_MAXNUP][2];
+    double PUP[LES_MAXNUP][5], VTIMUP[LES_MAXNUP], SPINUP[LES_MAXNUP];
+  };
+  extern LesHeprup heprup_;
+  extern LesHepeup hepeup_;
+
+  void __wrap_upinit_();
+  void __wrap_upevnt_();
+}
+
+class LesEventReader {
+
+public:
+
+  LesEventReader();
+  ~LesEventReader();
+					// ****** operations
+
+					// reads <init>, starts the thread;
+					// the first event is at byte offset
+					// (plain files, see LesEventIndex),
+					// then skip events are dropped;
+					// returns 0 on success
+  int    open (const std::string& fileName, int queueSize = 100,
+	       long skip = 0, off_t offset = 0);
+  void   close();
+					// false at the end of the file or
+					// on a parse error (see error())
+  bool   read (LesEvent& event);
+
+					// serve UPINIT/UPEVNT from this one
+  void   activate  () { _active = this; }
+  static LesEventReader* active() { return _active; }
+					// true once UPINIT was served by an
+					// active reader, i.e. it is wrapped
+  static bool            hooked() { return _hooked; }
+
+  static bool gzipped(const std::string& fileName);
+
+    					// ****** access functions
+  const LesInit&     init()    const { return _init; }
+  long               nRead()   const { return _nRead; }
+  long               nWaits()  const { return _nWaits; }
+  const std::string& error()   const { return _error; }
+
+private:
+
+  LesEventReader(const LesEventReader&);
+  LesEventReader& operator=(const LesEventReader&);
+
+  static void* run(void* self);
+  void         produce();
+  bool         getline();
+  int          findTag(const char* tag);
+  int          readInit();
+  int          parseEvent(LesEvent& event);
+
+  static LesEventReader* _active;
+  static bool            _hooked;
+  friend void ::__wrap_upinit_();
+
+  void*                  _file;         // gzFile
+  std::string            _fileName;
+  std::vector<char>      _line;
+  LesInit                _init;
+  long                   _skip;
+					// ring of decoded events, guarded
+					// by _mutex: the thread fills
+					// [_in,_in+free), read() empties
+					// [_out,_out+_nFull)
+  std::vector<LesEvent>  _ring;
+  int                    _in, _out, _nFull;
+  bool                   _eof, _stop, _running;
+  pthread_t              _thread;
+  pthread_mutex_t        _mutex;
+  pthread_cond_t         _notEmpty;
+  pthread_cond_t         _notFull;
+
+  long                   _nRead;
+  long                   _nWaits;
+  std::string            _error;
+  bool                   _reported;
+};
+
+#endif
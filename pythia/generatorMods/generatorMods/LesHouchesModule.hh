@@ -34,12 +34,15 @@ typedef AbsParmGeneral<long> AbsParmGeneral_long;
 #include "generatorMods/PythiaSetCommands.hh"
 #include "generatorMods/PythiaShowCommands.hh"
 #include "generatorMods/AbsGenModule.hh"
+#include "generatorMods/GenHerwigRecord.hh"
 #include "generatorMods/PythiaMenu.hh"
 
 #include "generatorMods/HerwigMenu.hh"
 
 #include <string>
 
+class LesEventReader;
+
 //		---------------------
 // 		-- Class Interface --
 //		---------------------
@@ -91,6 +94,11 @@ private:
   AbsParmGeneral<std::string> _stddatfile;
 
   AbsParmGeneral<int>  _firstEventToRead;
+  AbsParmGeneral<bool> _useEventIndex;
+  AbsParmGeneral<std::string> _eventIndexFile;
+  AbsParmGeneral<int>  _eventsToRead;
+  AbsParmGeneral<std::string> _lesReader;
+  AbsParmGeneral<int>  _lesReaderQueue;
   AbsParmGeneral<int>  _putResonance;
   AbsParmList<int>     _skipResonance;
   AbsParmGeneral<bool> _scaleOfKtClus;
@@ -101,6 +109,13 @@ private:
   PythiaMenu* _pythiaMenu;
   HerwigMenu* _herwigMenu;
 
+  // LesPSModel, resolved once at beginJob
+  enum PSModel { PS_PYTHIA, PS_HERWIG, PS_UNKNOWN };
+  PSModel _psModel;
+
+  // C++ event file reader (LesReader CXX), 0 for the Fortran readers
+  LesEventReader* _reader;
+
   static LesHouchesModule* _instance;
   struct Cleaner { ~Cleaner(); };
 
@@ -112,9 +127,21 @@ private:
   // event counter
   int _events;
 
+  // index of the HERWIG record after hwghep
+  GenHerwigRecord _herwigRecord;
+
   // for STDHEP
   int _mxevt;
 
+  // events firstEventToRead... of LesDatFile, read instead of it
+  std::string _sliceFile;
+
+  // copies the requested events into _sliceFile, 0 on success
+  int  openSlice(const std::string& datFile, int nskip);
+
+  // starts the C++ reader at event nskip+1, 0 on success
+  int  openReader(const std::string& datFile, int nskip);
+
 protected:
 
 private:
@@ -126,6 +153,11 @@ private:
       _lesdatfile("LesDatFile", this, "bases"),
       _lespsmodel("LesPSModel", this, "PYTHIA"),
       _firstEventToRead("firstEventToRead", this, 1),
+      _useEventIndex("useEventIndex", this, true),
+      _eventIndexFile("EventIndexFile", this, ""),
+      _eventsToRead("eventsToRead", this, 0),
+      _lesReader("LesReader", this, "FORTRAN"),
+      _lesReaderQueue("LesReaderQueue", this, 100),
       _putResonance("putResonance", this, 1),
       _skipResonance("skipResonance", this,0,6,0,-30,30),
       _scaleOfKtClus("scaleOfKtClus", this, false),
@@ -134,7 +166,9 @@ private:
       _stddatfile("StdhepFileName", this, "stdhep.dat"),
       _useStdEvent("NumOfStdEvent", this, 10),
       _pythiaMenu(),
-      _herwigMenu()
+      _herwigMenu(),
+      _psModel(PS_UNKNOWN),
+      _reader(0)
   {}
 
   LesHouchesModule( const LesHouchesModule& m)
@@ -143,6 +177,11 @@ private:
       _lesdatfile("LesDatFile", this, "bases"),
       _lespsmodel("LesPSModel", this, "PYTHIA"),
       _firstEventToRead("firstEventToRead", this, 1),
+      _useEventIndex("useEventIndex", this, true),
+      _eventIndexFile("EventIndexFile", this, ""),
+      _eventsToRead("eventsToRead", this, 0),
+      _lesReader("LesReader", this, "FORTRAN"),
+      _lesReaderQueue("LesReaderQueue", this, 100),
       _putResonance("putResonance", this, 1),
       _skipResonance("skipResonance", this,0,6,0,-30,30),
       _scaleOfKtClus("scaleOfKtClus", this, false),
@@ -151,7 +190,9 @@ private:
       _stddatfile("StdhepFileName", this, "stdhep.dat"),
       _useStdEvent("NumOfStdEvent", this, 10),
       _pythiaMenu(),
-      _herwigMenu()
+      _herwigMenu(),
+      _psModel(PS_UNKNOWN),
+      _reader(0)
   {}
 
 };
@@ -0,0 +1,84 @@
+//
+// MinBiasLibraryMenu.hh - pre-generated min-bias event library;
+//                         talk-to's live in their own menu so that
+//                         each min-bias module (MinBiasModule,
+//                         PythiaMinBias, MixFakeEv) can own one.
+//
+//   writeFile  the module generates as usual and every interaction
+//              it puts in /HEPEVT/ is also appended to the library,
+//              a GenEventCache file (one interaction per record)
+//   readFile   the module does not run its generator: every
+//              interaction is a randomly chosen library event,
+//              rotated by a random phi (rotatePhi) and moved to a
+//              new z vertex (zSigma, mm, 0 = keep it at the
+//              library origin and leave it to GenPrimVertModule)
+//
+//   Library events are recorded before the GenAcceptanceMenu cuts.
+//   The random choices use the AbsGenModule "SIMULATION" engine.
+//
+
+#ifndef MINBIASLIBRARYMENU_HH
+#define MINBIASLIBRARYMENU_HH
+
+#include <iosfwd>
+#include <string>
+
+#include "Framework/APPMenu.hh"
+#include "Framework/AbsParmGeneral.hh"
+
+#ifdef CDF
+#include "BaBar/Cdf.hh"
+#endif
+
+#include "generatorMods/GenEventCache.hh"
+
+class HepRandomEngine;
+
+class MinBiasLibraryMenu : public APPMenu {
+
+public:
+  enum { MAXREADTRIES = 10 };
+
+  MinBiasLibraryMenu ( AppModule* target=0,
+		       std::string menuName = "MinBiasLibraryMenu",
+		       std::string title    = "Min-bias event library" );
+  ~MinBiasLibraryMenu() {}
+
+					// beginJob/endJob of the owner,
+					// open returns 0 on success
+  int    open (const char* who);
+  void   close(std::ostream& os, const char* who);
+
+  bool   writing() const { return _writer.isOpen(); }
+  bool   reading() const { return _reader.nEvents() > 0; }
+
+					// write mode: appends the interaction
+					// in the commons to the library
+  void   record (const HEPEVT& hep, const HEPEV4& hep4);
+					// read mode: fills the commons with a
+					// random library interaction, tries
+					// MAXREADTRIES events if they can't be
+					// read, then aborts the job and leaves
+					// NHEP = 0; returns 0 on success.
+					// Not a callGenerator() return code.
+  int    overlay(HepRandomEngine* engine, HEPEVT& hep, HEPEV4& hep4);
+
+  long   nWritten()  const { return _nWritten; }
+  long   nOverlaid() const { return _nOverlaid; }
+
+private:
+
+  AbsParmGeneral<std::string> _writeFile;
+  AbsParmGeneral<int>         _compression;
+  AbsParmGeneral<std::string> _readFile;
+  AbsParmGeneral<bool>        _rotatePhi;
+  AbsParmGeneral<double>      _zSigma;
+
+  GenEventCacheWriter _writer;
+  GenEventCacheReader _reader;
+
+  long _nWritten;
+  long _nOverlaid;
+};
+
+#endif // MINBIASLIBRARYMENU_HH
@@ -15,6 +15,7 @@ using std::ostream;
 // Base Class Headers --
 //----------------------
 #include <math.h>
+#include <vector>
 
 #include "Framework/AbsParmGeneral.hh"
 typedef AbsParmGeneral<long> AbsParmGeneral_long;
@@ -24,6 +25,9 @@ class AppResult;
 class HepRandomEngine;
 
 #include "generatorMods/AbsGenModule.hh"
+#include "generatorMods/InverseCdfTable.hh"
+#include "generatorMods/GenDecayKernel.hh"
+#include "generatorMods/MinBiasLibraryMenu.hh"
 
 class MinBiasModule : public AbsGenModule {
 
@@ -53,6 +57,25 @@ protected:
 
   int inelasticEvent,singleDiffractiveEvent,doubleDiffractiveEvent,
       elasticEvent;
+
+                                        // 1+cos^2 table of generate_random_o2,
+					// built on its first call
+  static InverseCdfTable _o2Table;
+
+					// pt tables on a log(mass) grid from
+					// 60 GeV to the CM energy, built at
+					// beginJob (kin_tables talk-to)
+  enum { NPTTABLES = 64 };
+  InverseCdfTable _ptTable[NPTTABLES+1];
+  double  _ptLogAm0, _ptDLogAm;
+					// y, pt, phi of the particles of the
+					// current cluster, drawn in one batch
+  std::vector<double> _kinRn;
+  std::vector<double> _kinY, _kinPt, _kinPhi;
+  int     _kinNext;
+					// momenta of the current cluster for
+					// the boost to the lab
+  GenDecayKernel::Momenta _cluster;
           
 public:
 
@@ -123,6 +146,11 @@ public:
   double  generate_random_o2(void);
   double  generate_pt(double amx,int nt);
   double  generate_rapidiy(double amx);
+
+  void    build_kinematics_tables(void);
+  void    generate_fire_ball_kinematics(double amx,int nt,int n);
+  double  pt_from_table(double amx,int nt,double rn);
+  double  rapidity_from_flat(double amx,double rn);
   double  mbr_gamma(double);
 
   void    print(void);
@@ -165,6 +193,10 @@ private:
    AbsParmGeneral<float> _epsilon;
    AbsParmGeneral<float> _sigpomp;
    AbsParmGeneral<float> _alpha;
+   AbsParmGeneral<int> _kinTables;
+
+  // pre-generated event library, write or overlay
+   MinBiasLibraryMenu _library;
 
   // Random number menu
   APPMenu _randomNumberMenu;
@@ -197,6 +229,8 @@ private:
     _epsilon( "epsilon", this, 0.104 ),
     _sigpomp( "sigpomp", this, 2.82 ),
     _alpha( "alpha", this, 0.25 ),
+    _kinTables( "kin_tables", this, 1 ),
+    _library( this ),
     _randomSeed1( "RandomSeed1", this, MinBiasModule::_defaultRandomSeed1 ),
     _randomSeed2( "RandomSeed2", this, MinBiasModule::_defaultRandomSeed2 )
   {}
@@ -221,6 +255,8 @@ private:
     _epsilon( "epsilon", this, 0.104 ),
     _sigpomp( "sigpomp", this, 2.82 ),
     _alpha( "alpha", this, 0.25 ),
+    _kinTables( "kin_tables", this, 1 ),
+    _library( this ),
     _randomSeed1( "RandomSeed1", this, MinBiasModule::_defaultRandomSeed1 ),
     _randomSeed2( "RandomSeed2", this, MinBiasModule::_defaultRandomSeed2 )
   {}
@@ -34,6 +34,7 @@
 //----------------------
 #include <iostream>
 #include <string>
+#include <vector>
 
 class APPCommand;
 class APPMenu;
@@ -48,6 +49,8 @@ class HepRandomEngine;
 typedef AbsParmGeneral<long> AbsParmGeneral_long;
 
 #include "generatorMods/AbsGenModule.hh"
+#include "generatorMods/MinBiasLibraryMenu.hh"
+#include "generatorMods/GenFakeRecipes.hh"
 
 // CHLEP Random number classes
 //class HepRandomEngine;
@@ -154,6 +157,7 @@ protected:
   bool            UseEta;       // Switch between Eta and Theta generation
   MixFakeEvCommand   _useCommand;
   MixFakeEvCommand   _genCommand;
+  MixFakeEvCommand   _recipeCommand;
 
   // Random number menu
   APPMenu _randomNumberMenu;
@@ -173,6 +177,31 @@ protected:
   GenPars  _genEta;     // Parameters for Generating Eta
   GenPars  _genPhi;     // Parameters for Generating Phi
 
+  MinBiasLibraryMenu _library;  // pre-generated event library
+
+  // Particle recipes (see GenFakeRecipes): when recipes are given the
+  // event is made of all of them and the CdfCode/NParticles settings
+  // are ignored; recipes without a histogram take their kinematics
+  // from the generate parameters.
+  GenFakeRecipes _recipes;
+
+					// the generate parameters as recipe
+					// kinematics
+  class RecipeKinematics : public GenFakeRecipes::Kinematics {
+  public:
+    RecipeKinematics(const MixFakeEv* module) : _module(module) {}
+    bool usePt   () const;
+    void momentum(int n, double* p);
+    void polar   (int n, double* v);
+    void toEta   (int n, double* v);
+    void phi     (int n, double* v);
+  private:
+    const MixFakeEv* _module;
+  };
+  friend class RecipeKinematics;
+
+  void generateValues(const GenPars& pars, int n, double* out) const;
+
 public:
   static const char* genId;
   static HepRandomEngine* mixFakeEvEngine;
@@ -220,6 +249,10 @@ public:
 
   void  Set(char* name, float mean, float sigma, float pmax, float pmin , 
             float power, int mode);
+					// returns 0 on success
+  int   addRecipe(int code, double mean, int poisson, double cone,
+		  const char* histFile);
+  void  clearRecipes() { _recipes.clear(); }
 
                                         // ****** print methods
 
@@ -230,6 +263,7 @@ private:
     AbsGenModule( name, description ),
     _useCommand("use",this),
     _genCommand("generate",this),
+    _recipeCommand("recipe",this),
     _randomSeed1("RandomSeed1",this,MixFakeEv::_defaultRandomSeed1),
     _randomSeed2("RandomSeed2",this,MixFakeEv::_defaultRandomSeed2),
     _genMom(50.,0.,  1.,100.,0.,1), // default parameters
@@ -244,6 +278,7 @@ private:
     AbsGenModule( "x", "x" ),
     _useCommand("use",this),
     _genCommand("generate",this),
+    _recipeCommand("recipe",this),
     _randomSeed1("RandomSeed1",this,MixFakeEv::_defaultRandomSeed1),
     _randomSeed2("RandomSeed2",this,MixFakeEv::_defaultRandomSeed2),
     _genMom(50.,0.,  1.,100.,0.,1), // default parameters
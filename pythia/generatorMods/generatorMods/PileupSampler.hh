@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Table driven sampler for the number of primary interactions
+//      generated per event by AbsGenModule
+//
+//   The multiplicity distribution is tabulated once (beginRun) and
+//   turned into a Walker alias table, so that every event costs one
+//   flat random number whatever the mode:
+//
+//     FIXED         n = mean
+//     POISSON       Poisson(mean)
+//     TRUNCPOISSON  Poisson(mean) for n >= 1
+//     PROFILE       sum_b w_b Poisson(mu_b), the luminosity weighted
+//                   mixture of the (weight, mean) bins read from a
+//                   profile file for the current run
+//
+//   Profile file, text:
+//     # run   weight   mean        (run 0 = used for every run)
+//     0       0.25     1.2
+//     ...
+//   or binary: the 8 characters "PUPROF01", an int32 record count and
+//   records of { int32 run; double weight; double mean; }.
+//
+//----------------------------------------------------------------------------
+#ifndef PILEUPSAMPLER_HH__
+#define PILEUPSAMPLER_HH__
+
+#include <string>
+#include <vector>
+
+class HepRandomEngine;
+
+class PileupSampler {
+
+public:
+
+  enum Mode { FIXED = 1, POISSON = 2, TRUNCPOISSON = 3, PROFILE = 4 };
+
+  PileupSampler();
+  ~PileupSampler() {}
+					// ****** operations
+
+					// FIXED/POISSON/TRUNCPOISSON tables,
+					// mean < 0 taken as 0
+  void   init(Mode mode, double mean);
+
+					// PROFILE table for a given run,
+					// returns number of bins used
+  int    initProfile(int run);
+
+					// reads the profile file, returns 0
+					// on success
+  int    readProfile(const std::string& fileName);
+
+					// tabulates an arbitrary distribution
+					// of n = 0 .. weights.size()-1
+  void   initTable(const std::vector<double>& weights);
+
+  int    shoot(HepRandomEngine* engine) const;
+
+    					// ****** access functions
+  Mode   mode()        const { return _mode; }
+  int    maxN()        const { return int(_pmf.size()) - 1; }
+  double probability(int n) const;
+
+private:
+
+  struct ProfileBin {
+    int    run;
+    double weight;
+    double mean;
+  };
+					// adds w*Poisson(mu) to pmf
+  static void addPoisson(std::vector<double>& pmf, double mu, double w);
+
+  Mode                    _mode;
+  int                     _fixed;
+  std::vector<double>     _pmf;     // normalised distribution
+  std::vector<double>     _prob;    // alias table
+  std::vector<int>        _alias;
+  std::vector<ProfileBin> _profile;
+};
+
+#endif
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Local cache of the PYTHIA cross-section maximisation (PYMAXI), used
+//      by PythiaModule to skip the maximisation of PYINIT for jobs whose
+//      PYTHIA settings were already seen
+//
+//   An entry holds what PYMAXI changed: the XSEC(ISUB,1) maxima and
+//   COEF(ISUB,1..20) coefficients of the subprocesses, XSEC(0,1) and
+//   the number of PYR calls it made.  Entries are keyed by a 64-bit
+//   hash of the full PYTHIA parameter set.
+//
+//   Binary file, one record per appended entry (a later record with
+//   the same key wins): the 8 characters "PYMAXI01", uint64 key,
+//   int32 nsub, int64 nRandom, double XSEC(0,1), then nsub records of
+//   { int32 isub; double xsec; double coef[20]; }.
+//
+//----------------------------------------------------------------------------
+#ifndef PYTHIAMAXICACHE_HH__
+#define PYTHIAMAXICACHE_HH__
+
+#include <map>
+#include <string>
+#include <vector>
+
+class PythiaMaxiCache {
+
+public:
+
+  enum { NCOEF = 20 };
+
+  struct Entry {
+    Entry() : nRandom(0), xsec0(0.) {}
+    long                nRandom;        // PYR calls made by PYMAXI
+    double              xsec0;          // XSEC(0,1)
+    std::vector<int>    isub;           // subprocesses changed by PYMAXI
+    std::vector<double> xsec;           // XSEC(isub,1)
+    std::vector<double> coef;           // COEF(isub,1..20), NCOEF per isub
+  };
+
+  PythiaMaxiCache() {}
+  ~PythiaMaxiCache() {}
+					// ****** operations
+
+					// 64-bit FNV-1a hash of the values,
+					// or of bytes continuing hash h
+  static unsigned long long key(const std::vector<double>& pars);
+  static unsigned long long key(const void* data, unsigned long nbytes,
+				unsigned long long h = 14695981039346656037ULL);
+
+					// a missing file is an empty cache;
+					// returns 0 on success
+  int    read  (const std::string& fileName);
+					// appends one record to the file and
+					// to the cache; returns 0 on success
+  int    append(const std::string& fileName, unsigned long long key,
+		const Entry& entry);
+
+    					// ****** access functions
+  const Entry* find(unsigned long long key) const;
+  int          size() const { return _entries.size(); }
+
+private:
+
+  std::map<unsigned long long, Entry> _entries;
+};
+
+#endif
@@ -41,8 +41,11 @@ public:
   const std::string getTarget()     const { return _target.value(); }
   const std::string frame()         const { return _frame.value(); }
   const std::string pygiveFile()    const { return _pygiveFile.value(); }
+  const std::string maxiCacheFile() const { return _maxiCacheFile.value(); }
   int msel()           const { return _msel.value(); }
   int selectPdg()           const { return _selectPdgCode.value(); }
+  int rehadronizeTries()    const { return _rehadronizeTries.value(); }
+  bool rehadronizeWeight()  const { return _rehadronizeWeight.value(); }
   int firstlistevent() const { return _firstlistevent.value(); }
   int lastlistevent()  const { return _lastlistevent.value(); }
   int eventlistlevel() const { return _eventlistlevel.value(); }
@@ -62,6 +65,8 @@ private:
   // various input parameters
   AbsParmGeneral<int>  _msel;
   AbsParmGeneral<int>  _selectPdgCode;
+  AbsParmGeneral<int>  _rehadronizeTries;
+  AbsParmGeneral<bool> _rehadronizeWeight;
   AbsParmGeneral<int>  _firstlistevent;
   AbsParmGeneral<int>  _lastlistevent;
   AbsParmGeneral<int>  _eventlistlevel;
@@ -76,6 +81,7 @@ private:
   AbsParmGeneral<std::string>  _target;
   AbsParmGeneral<std::string>  _frame;
   AbsParmGeneral<std::string>  _pygiveFile;
+  AbsParmGeneral<std::string>  _maxiCacheFile;
   AbsParmGeneral<bool>  _allowBMixing;
   AbsParmGeneral<int>  _tuneUE;
 
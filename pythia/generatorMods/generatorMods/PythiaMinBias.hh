@@ -24,6 +24,7 @@
 #include "generatorMods/PythiaShowCommands.hh"
 #include "generatorMods/AbsGenModule.hh"
 #include "generatorMods/PythiaMenu.hh"
+#include "generatorMods/MinBiasLibraryMenu.hh"
 
 #include <string>
 
@@ -54,6 +55,8 @@ public:
 private:
 
   PythiaMenu* _pythiaMenu;
+					// pre-generated event library
+  MinBiasLibraryMenu _library;
 
 protected:
 
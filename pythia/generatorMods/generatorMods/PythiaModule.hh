@@ -84,6 +84,18 @@ private:
 
   PythiaMenu* _pythiaMenu;
 
+					// selectPdgCode by re-hadronisation:
+					// Pyevnt stops at parton level and
+					// only PYEXEC is repeated
+  bool   _rehadronize;
+  int    _mstp111;              // user MSTP(111), restored at endJob
+  double _rehadWeight;          // weight of the current event
+  long   _rehadHard;            // hard processes generated
+  long   _rehadTries;           // PYEXEC calls
+  long   _rehadEvents;          // events selected
+  double _rehadSumWeight;
+  void   rehadronizeSelect(int code, bool eventList);
+
 protected:
 
 private:
@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// Description:
+//	Local run -> integrated luminosity table, used by GenInputManager
+//      to pick luminosity weighted run numbers without a database
+//
+//   The table is sorted by run and holds the cumulative luminosity, so
+//   a run is chosen with one flat random number and a binary search.
+//
+//   Text file (e.g. a dump of the run database):
+//     # run    integrated luminosity
+//     138425   12.31
+//     ...
+//   or binary, as written by makeRunLumiTable: the 8 characters
+//   "RUNLUMI1", an int32 record count and records of
+//   { int32 run; double lumi; } sorted by run.
+//
+//----------------------------------------------------------------------------
+#ifndef RUNLUMITABLE_HH__
+#define RUNLUMITABLE_HH__
+
+#include <string>
+#include <vector>
+
+class HepRandomEngine;
+
+class RunLumiTable {
+
+public:
+
+  RunLumiTable() {}
+  ~RunLumiTable() {}
+					// ****** operations
+
+					// reads a text or binary table, runs
+					// outside [runMin,runMax] are skipped
+					// (0 = no limit); returns 0 on success
+  int    read (const std::string& fileName, int runMin = 0, int runMax = 0);
+  int    write(const std::string& fileName) const;
+
+  void   add  (int run, double lumi);   // unsorted, call sort() after
+  void   sort ();
+
+					// luminosity weighted run
+  int    shoot(HepRandomEngine* engine) const;
+  int    find (double u) const;         // run at cumulative fraction u
+
+    					// ****** access functions
+  int    size()            const { return _runs.size(); }
+  int    run (int i)       const { return _runs[i]; }
+  double lumi(int i)       const;
+  double totalLumi()       const { return _cumul.empty() ? 0. : _cumul.back(); }
+
+private:
+
+  std::vector<int>    _runs;
+  std::vector<double> _cumul;           // lumi of runs [0,i]
+};
+
+#endif
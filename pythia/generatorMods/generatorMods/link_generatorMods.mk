@@ -37,3 +37,19 @@ override LINK_mcfm              += generatorMods
 
 
 
+
+# PythiaModule maxiCacheFile: PYINIT's call to PYMAXI (and the PYR calls
+# it makes) go through the hooks in PythiaModule.cc.  Opt-in, link with
+# PYTHIA_MAXI_CACHE=1: every PYR call of the job then passes through a
+# counting shim (one more call and a test per random number)
+ifneq ($(PYTHIA_MAXI_CACHE),)
+override LDFLAGS += -Wl,--wrap=pymaxi_ -Wl,--wrap=pyr_
+endif
+
+# LesHouchesModule LesReader CXX: UPINIT/UPEVNT go through the hooks in
+# LesEventReader.cc, which read gzip'd files and run a reading thread.
+# Opt-in, link with LES_READER_CXX=1
+ifneq ($(LES_READER_CXX),)
+override LDFLAGS   += -Wl,--wrap=upinit_ -Wl,--wrap=upevnt_
+endif
+override LOADLIBES += -lz -lpthread
@@ -21,36 +21,42 @@
 #include "ErrorLogger_i/gERRLOG.hh"
 #include "HepTuple/HepHist1D.h"
 #include "r_n/CdfRn.hh"
-#include "CLHEP/Random/RandPoisson.h"
 #include "CLHEP/Random/RandomEngine.h"
 #include "ParticleDB/hepevt.hh"
 #include "evt/evt.h"
 #include "generatorMods/AbsGenModule.hh"
+#include "generatorMods/HepevtPool.hh"
+#include "generatorMods/GenOutputManager.hh"
 #include "stdhep_i/Heplun.hh"
 #include "AbsEnv/AbsEnv.hh"
 
 int  const AbsGenModule::FIXEDMODE    = 1;
 int  const AbsGenModule::POISSONMODE  = 2;
 int  const AbsGenModule::TRUNCPOISSON = 3;
+int  const AbsGenModule::PROFILEMODE  = 4;
 
 HepRandomEngine* AbsGenModule::absGenEngine = 0;
 
-class NameEqual {
-public:
-	NameEqual(const std::string& name) : hist(name) {}
-	bool operator()(HepObj* ptr) const { return hist==ptr->title(); }
-	std::string hist;
-};
-
 //______________________________________________________________________________
 AbsGenModule::AbsGenModule(const char* name, const char* title)
   : HepHistModule(name,title),
-    _mean          ("MEAN"            , this, 1.),
     _generationMode("MODE"            , this, "FIXED"),
-    _nGeneratedEvents(0)
+    _nGeneratedEvents(0),
+    _mean          ("MEAN"            , this, 1.),
+    _profileFile   ("PROFILE_FILE"    , this, ""),
+    _acceptance(this),
+    _timingParm    ("TIMING"          , this, false),
+    _timingFile    ("TIMING_FILE"     , this, ""),
+    _timingOn(false),
+    _hepevtPool(HepevtPool::Instance()),
+    _hNevents(-1)
 {
    commands()->append(&_mean);
    commands()->append(&_generationMode);
+   commands()->append(&_profileFile);
+   commands()->append(&_acceptance);
+   commands()->append(&_timingParm);
+   commands()->append(&_timingFile);
 
    std::list< std::string > enumNames;
 
@@ -58,7 +64,14 @@ AbsGenModule::AbsGenModule(const char* name, const char* title)
    enumNames.push_back( "FIXED" );
    enumNames.push_back( "POISSON" );
    enumNames.push_back( "TRUNCPOISSON" );
+   enumNames.push_back( "PROFILE" );
    _generationMode.initValidList( enumNames );
+   _profileFile.addDescription(
+     "      \t\t\tPile-up profile (run weight mean) used in PROFILE mode");
+   _timingParm.addDescription(
+     "      \t\t\tTime generator phases, summary printed at endJob");
+   _timingFile.addDescription(
+     "      \t\t\tOptional file for the machine readable timing summary");
 
    // make sure pointers to FORTRAN common
    // blocks are initialized
@@ -75,13 +88,41 @@ AppResult AbsGenModule::beginJob( AbsEvent* job ) {
 
   _initStdhepLun(6);
   AbsGenModule::absGenEngine = CdfRn::Instance()->GetEngine("SIMULATION");
+  _timingOn = _timingParm.value();
+  _timing.reset();
 
+  if ( generationMode() == PROFILEMODE ) {
+    if ( _multiplicity.readProfile(_profileFile.value()) ) {
+      return AppResult::ERROR;
+    }
+  }
+  if ( _mean.value() < 0. ) {
+    ERRLOG(ELerror,"[GEN_PILEUP_MEAN]")
+      << name() << ": MEAN = " << _mean.value()
+      << ", the number of interactions can't be negative" << endmsg;
+    return AppResult::ERROR;
+  }
   return genBeginJob();  
 }
 
 //______________________________________________________________________________
 AppResult AbsGenModule::beginRun( AbsEvent* aRun ) 
 {
+					// mode strings are resolved here once,
+					// event() only draws from the table
+  int mode = generationMode();
+  if ( mode == PROFILEMODE ) {
+    int run = AbsEnv::instance()->runNumber();
+    if ( _multiplicity.initProfile(run) == 0 ) {
+      ERRLOG(ELerror,"[GEN_PILEUP_PROFILE]")
+	<< name() << ": no pile-up profile bins for run " << run
+	<< ", using POISSON with MEAN = " << _mean.value() << endmsg;
+      _multiplicity.init(PileupSampler::POISSON,_mean.value());
+    }
+  }
+  else {
+    _multiplicity.init(PileupSampler::Mode(mode),_mean.value());
+  }
   return genBeginRun(aRun);
 }
 
@@ -92,6 +133,17 @@ AppResult AbsGenModule::endRun( AbsEvent* aRun )
 
 AppResult AbsGenModule::endJob( AbsEvent* aJob ) 
 {
+  if ( verbose() ) _hepevtPool->print(std::cout);
+  if ( _acceptance.enabled() ) _acceptance.print(std::cout,name());
+  if ( _timingOn ) {
+    _timing.print(std::cout,name());
+    if ( !_timingFile.value().empty() &&
+	 _timing.writeSummary(_timingFile.value(),name()) ) {
+      ERRLOG(ELerror,"[GEN_TIMING_FILE]")
+	<< name() << ": can't write timing summary to "
+	<< _timingFile.value() << endmsg;
+    }
+  }
   return genEndJob();
 }
 
@@ -102,32 +154,11 @@ AppResult AbsGenModule::event(AbsEvent* event) {
   // define number of primary interactions
   // to be generated
 
-  if (_generationMode.value() == "FIXED") {
-    nev = (int) _mean.value();
-    if ( verbose() ) {
-      Plot("nevents", nev*1., 11, -1., 10.);
-    }
-  }
-  else if (_generationMode.value() == "POISSON") {
-    HepRandomEngine* engine = AbsGenModule::absGenEngine;
-    nev = RandPoisson::shoot(engine,_mean.value());
-    if ( verbose() ) {
-      Plot("nevents", nev*1., 11, -1., 10.);
-    }
-  }
-  else if (_generationMode.value() == "TRUNCPOISSON") {
-    HepRandomEngine* engine =  AbsGenModule::absGenEngine;
-    // Dave Waters, 29 AUG 2004. Truncated Poisson - Poisson(n,mu) for n >= 1
-    nev = 0;
-    while (nev == 0) {
-      nev = RandPoisson::shoot(engine,_mean.value());
-    }
-    if ( verbose() ) {
-      Plot("nevents", nev*1., 11, -1., 10.);
-    }
-  }
-  else {
-    assert(0.); 
+  if ( _timingOn ) _timing.startEvent();
+  nev = _multiplicity.shoot(AbsGenModule::absGenEngine);
+  if ( verbose() ) {
+    if ( _hNevents < 0 ) _hNevents = histHandle("nevents", 11, -1., 10.);
+    fill(_hNevents, nev*1.);
   }
 					// ... and just tell the real generator
 					// to generate given number of events
@@ -136,16 +167,47 @@ AppResult AbsGenModule::event(AbsEvent* event) {
   Hepevt* cur;
   for (int i=0; i<nev; i++) {    
     do {      
-      rc = this->callGenerator(event);
-       				        // different generators produce their 
+      int ntry = 0;
+      do {
+	if ( _timingOn ) _timing.start(GenTiming::CALLGENERATOR);
+	rc = this->callGenerator(event);
+	if ( _timingOn ) _timing.stop (GenTiming::CALLGENERATOR);
+					// different generators produce their 
 					// output in different format, convert
 					// everything to /HEPEVT/
-      this->fillHepevt();
-      cur = new Hepevt( *hepevt->HepevtPtr(), *hepevt->Hepev4Ptr() );
-      hepevt->contentHepevt().push_back( cur );
+	if ( _timingOn ) _timing.start(GenTiming::FILLHEPEVT);
+	this->fillHepevt();
+	if ( _timingOn ) _timing.stop (GenTiming::FILLHEPEVT);
+	GenAcceptanceMenu::Decision d = 
+	  _acceptance.decide(*hepevt->HepevtPtr(),ntry++);
+	if ( d == GenAcceptanceMenu::ACCEPTED ) break;
+	if ( d == GenAcceptanceMenu::FORCED ) {
+	  ERRLOG(ELerror,"[GEN_ACCEPT_MAXTRIES]")
+	    << name() << ": no event passed the generator level "
+	    << "acceptance in " << ntry << " tries, keeping the last one"
+	    << endmsg;
+	  break;
+	}
+					// rejected: nothing was stored yet,
+					// just generate the next one
+	hepevt->clearCommon();
+      } while (true);
+      if ( _timingOn ) _timing.start(GenTiming::HEPEVTCOPY);
+      if ( GenOutputManager::streamOutput() ) {
+					// nobody downstream needs the copy:
+					// write HEPG/HEP4 right away
+	GenOutputManager::writeBanks(event);
+      }
+      else {
+	cur = _hepevtPool->acquire( *hepevt->HepevtPtr(), 
+				    *hepevt->Hepev4Ptr() );
+	hepevt->contentHepevt().push_back( cur );
+      }
       hepevt->clearCommon();  
+      if ( _timingOn ) _timing.stop (GenTiming::HEPEVTCOPY);
     } while (rc);
   }
+  if ( _timingOn ) _timing.stopEvent();
   return AppResult::OK;
 }
 
@@ -169,6 +231,10 @@ int AbsGenModule::generationMode()
     {
       return TRUNCPOISSON;
     }
+  else if ( _generationMode.value() == "PROFILE" )
+    {
+      return PROFILEMODE;
+    }
   // This can't happen
   assert(0);
   return 0;
@@ -179,23 +245,25 @@ int AbsGenModule::outputEvent( AbsEvent* event ) {
   return 0;
 }
 
+AbsGenModule::HistHandle AbsGenModule::histHandle(const std::string& title, 
+						  const int& nb, 
+						  const float& low, 
+						  const float& high) 
+{
+  std::map<std::string, HistHandle>::const_iterator i = _histIndex.find(title);
+  if ( i != _histIndex.end() ) return i->second;
+
+  HistHandle h = _hists.size();
+  _hists.push_back( &fileManager()->hist1D(title,nb,low,high) );
+  _histIndex[title] = h;
+  return h;
+}
+
 void AbsGenModule::Plot(const std::string& title, 
 			const float& var, 
 			const int& nb, 
 			const float& low, 
 			const float& high, float weight) 
 {  
-
-	std::vector<HepObj*>::iterator result = std::find_if(_histList.begin(), 
-						   _histList.end(),
-						   NameEqual(title));
-	HepHist1D* h;
-	if (result == _histList.end()) 
-	{
-		h = &fileManager()->hist1D(title,nb,low,high);
-		_histList.push_back(h);
-	}
-	else 
-		h = &fileManager()->retrieveHist1D(title);
-	h->accumulate(var,weight);
+  fill(histHandle(title,nb,low,high),var,weight);
 }
@@ -0,0 +1,187 @@
+//--------------------------------------------------------------------------
+// BeamlineCache
+//
+// local run -> beamline file with binary search and LRU
+//
+//------------------------------------------------------------------------
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/BeamlineCache.hh"
+
+static const char BEAMLINE_MAGIC[8] = { 'B','M','L','C','A','C','H','2' };
+static const long BEAMLINE_HEADER   = 16;
+
+//______________________________________________________________________________
+BeamlineCache::BeamlineCache()
+  : _file(0),
+    _n(0),
+    _nLookups(0),
+    _nLruHits(0),
+    _nReads(0)
+{ }
+
+//______________________________________________________________________________
+BeamlineCache::~BeamlineCache()
+{
+  close();
+}
+
+//______________________________________________________________________________
+void BeamlineCache::close()
+{
+  if ( _file ) fclose(_file);
+  _file = 0;
+  _text.clear();
+  _lru .clear();
+  _n = 0;
+}
+
+//______________________________________________________________________________
+int BeamlineCache::open(const std::string& fileName)
+{
+  close();
+  FILE* f = fopen(fileName.c_str(), "rb");
+  if ( !f ) {
+    ERRLOG(ELerror,"[GEN_BEAMLINE_CACHE]")
+      << "BeamlineCache: can't open " << fileName << endmsg;
+    return -1;
+  }
+  char magic[8];
+  int  hdr[2];
+  if ( fread(magic,1,8,f) == 8 && memcmp(magic,BEAMLINE_MAGIC,8) == 0 ) {
+    if ( fread(hdr,sizeof(int),2,f) != 2 || hdr[1] != int(sizeof(Entry)) ) {
+      ERRLOG(ELerror,"[GEN_BEAMLINE_CACHE]")
+	<< "BeamlineCache: bad header in " << fileName << endmsg;
+      fclose(f);
+      return -1;
+    }
+    fseek(f,0,SEEK_END);
+    long size = ftell(f);
+    if ( size != BEAMLINE_HEADER + long(hdr[0])*long(sizeof(Entry)) ) {
+      ERRLOG(ELerror,"[GEN_BEAMLINE_CACHE]")
+	<< "BeamlineCache: truncated " << fileName << endmsg;
+      fclose(f);
+      return -1;
+    }
+    _file = f;
+    _n    = hdr[0];
+  }
+  else {
+    fclose(f);
+    if ( readText(fileName,_text) ) {
+      ERRLOG(ELerror,"[GEN_BEAMLINE_CACHE]")
+	<< "BeamlineCache: no beamlines in " << fileName << endmsg;
+      return -1;
+    }
+    _n = _text.size();
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int BeamlineCache::readEntry(long i, Entry& e)
+{
+  if ( !_file ) {
+    e = _text[i];
+    return 0;
+  }
+  _nReads++;
+  if ( fseek(_file, BEAMLINE_HEADER + i*long(sizeof(Entry)), SEEK_SET) ) return -1;
+  return fread(&e,sizeof(Entry),1,_file) == 1 ? 0 : -1;
+}
+
+//______________________________________________________________________________
+int BeamlineCache::find(int run, Entry& e)
+{
+  _nLookups++;
+  for ( std::list<Entry>::iterator i = _lru.begin(); i != _lru.end(); ++i ) {
+    if ( i->run == run ) {
+      _nLruHits++;
+      _lru.splice(_lru.begin(), _lru, i);
+      e = *i;
+      return 0;
+    }
+  }
+					// binary search over the records
+  long lo = 0, hi = _n;
+  while ( lo < hi ) {
+    long mid = (lo + hi) / 2;
+    if ( readEntry(mid,e) ) return -1;
+    if      ( e.run < run ) lo = mid + 1;
+    else if ( e.run > run ) hi = mid;
+    else {
+      _lru.push_front(e);
+      if ( _lru.size() > LRUSIZE ) _lru.pop_back();
+      return 0;
+    }
+  }
+  return -1;
+}
+
+//______________________________________________________________________________
+static bool lessRun(const BeamlineCache::Entry& a, const BeamlineCache::Entry& b)
+{
+  return a.run < b.run;
+}
+
+//______________________________________________________________________________
+int BeamlineCache::readText(const std::string& fileName, std::vector<Entry>& v)
+{
+  v.clear();
+  std::ifstream in(fileName.c_str());
+  if ( !in ) return -1;
+  std::string line;
+  while ( std::getline(in,line) ) {
+    std::string::size_type c = line.find('#');
+    if ( c != std::string::npos ) line.erase(c);
+    std::istringstream is(line);
+    Entry e;
+    memset(&e,0,sizeof(e));
+    if ( is >> e.run >> e.source >> e.x >> e.y >> e.z 
+	    >> e.dxdz >> e.dydz >> e.sigmaZ ) {
+					// older dumps end with sigma_z
+      if ( !(is >> e.sigmaX >> e.sigmaY) ) e.sigmaX = e.sigmaY = 0.;
+      v.push_back(e);
+    }
+  }
+  sort(v);
+  return v.empty() ? -1 : 0;
+}
+
+//______________________________________________________________________________
+void BeamlineCache::sort(std::vector<Entry>& v)
+{
+					// a run dumped twice keeps the
+					// last beamline
+  std::stable_sort(v.begin(),v.end(),lessRun);
+  std::vector<Entry> u;
+  for ( unsigned i=0; i<v.size(); i++ ) {
+    if ( !u.empty() && u.back().run == v[i].run ) u.back() = v[i];
+    else u.push_back(v[i]);
+  }
+  v.swap(u);
+}
+
+//______________________________________________________________________________
+int BeamlineCache::writeFile(const std::string& fileName, const std::vector<Entry>& v)
+{
+  FILE* f = fopen(fileName.c_str(), "wb");
+  if ( !f ) return -1;
+  int hdr[2] = { int(v.size()), int(sizeof(Entry)) };
+  fwrite(BEAMLINE_MAGIC,1,8,f);
+  fwrite(hdr,sizeof(int),2,f);
+  if ( !v.empty() ) fwrite(&v[0],sizeof(Entry),v.size(),f);
+  return fclose(f) ? -1 : 0;
+}
+
+//______________________________________________________________________________
+void BeamlineCache::writeText(FILE* f, const Entry& e)
+{
+  fprintf(f, "%d %d %.9g %.9g %.9g %.9g %.9g %.9g %.9g %.9g\n", e.run,
+	  e.source, e.x, e.y, e.z, e.dxdz, e.dydz, e.sigmaZ, e.sigmaX,
+	  e.sigmaY);
+}
@@ -38,8 +38,10 @@
 #endif
 
 #include <sstream>
+#include <cctype>
 #include "inc/misc.hh"
 #include "generatorMods/FakeEv.hh"
+#include "generatorMods/GenValueBatch.hh"
 #include "evt/Event.hh"
 #include "stdhep_i/CdfHepevt.hh"
 #include "ParticleDB/ParticleDb.hh"
@@ -47,6 +49,7 @@
 
 // CLHEP Random Number headers
 #include "r_n/CdfRn.hh"
+#include "ErrorLogger_i/gERRLOG.hh"
 #include "CLHEP/Random/RandFlat.h"
 #include "CLHEP/Random/RandGaussT.h"
 #include "CLHEP/Random/RandExponential.h"
@@ -54,6 +57,11 @@
 const long FakeEv::_defaultRandomSeed1 = 922883591;
 const long FakeEv::_defaultRandomSeed2 = 109735476;
 const char* FakeEv::genId = "FAKE_EVENT";
+HepRandomEngine* FakeEv::fakeEvEngine = 0;
+
+					// variables a histogram can supply
+enum { HIST_NONE = 0, HIST_PT, HIST_P, HIST_ETA, HIST_THETA, HIST_Y, 
+       HIST_PHI };
 
 using std::ostream;
 using std::cout;
@@ -79,13 +87,20 @@ FakeEv::FakeEv() :
   _lowPt("lowPt",this,0.),
   _highPt("highPt",this,0.,0.),
   _nbinPt("nbinPt",this,0),
-  _valPt("valPt",this,1,200)
+  _valPt("valPt",this,1,200),
+  _hPt(-1),
+  _histFile("histFile",this,""),
+  _histX("histX",this,"PT"),
+  _histY("histY",this,""),
+  _histVarX(HIST_NONE),
+  _histVarY(HIST_NONE)
 {
   commands()->append(&_useCommand);
   commands()->append(&_genCommand);
   commands()->append(&_antiParticle);
   _initializeRandomTalkTo();
   _initializeUsePtHistTalkTo();
+  _initializeHistTalkTo();
 				        // <a name="qq">
 					// Fill default values for data
 					// Order of arguments to init:  
@@ -104,7 +119,6 @@ FakeEv::FakeEv() :
   PolarChoice     = NOCHOICE;
 					// default particle is Pi+
   CdfCode    = 401;
-  memset(_myValPt,0,200*sizeof(double));
 }
 
 FakeEv::~FakeEv() {
@@ -309,53 +323,94 @@ void FakeEv::menuHandler(char* menu, char* command, int argc, char** argv) {
 
 int FakeEv::callGenerator(AbsEvent* event) {
   double pt, p, mass, eta, theta, phi;
-  double px, py, pz, rn;
-  HepRandomEngine* engine = CdfRn::Instance()->GetEngine("FAKE_EVENT");
-
-  for (int i=0; i<NParticles; i++) {
-					// Generate Eta or Theta
+  double px, py, pz;
+  HepRandomEngine* engine = FakeEv::fakeEvEngine;
+  const int n = NParticles;
 //-----------------------------------------------------------------------------
-// add particle to /HEPEVT/
+// draw every variable for all the particles of the event, in the order
+// of the single particle case: code, mass, eta/theta/y, phi, pt/p
 //-----------------------------------------------------------------------------
-    int code = CdfCode;
-    if (_antiParticle.value() > 0) {
+  _bCode.resize(n);
+  _bMass.resize(n);
+  _bPolar.resize(n);
+  _bPhi.resize(n);
+  _bMom.resize(n);
+
+  if (_antiParticle.value() > 0) {
 //-----------------------------------------------------------------------------
-// generate mix of particles and antiparticles, check for antiparticle
+// generate mix of particles and antiparticles
 //-----------------------------------------------------------------------------
-      rn = RandFlat::shoot(engine,0.,1.);
-      if (rn < _antiParticle.value()) {
-	code = -CdfCode;
-      }
+    RandFlat::shootArray(engine,n,&_bCode[0],0.,1.);
+    for (int i=0; i<n; i++) {
+      _bCode[i] = (_bCode[i] < _antiParticle.value()) ? -CdfCode : CdfCode;
     }
+  }
+  else {
+    for (int i=0; i<n; i++) _bCode[i] = CdfCode;
+  }
 
-    mass = ParticleDb::Instance()->Mass(code);
-    if(useMass) {
-      mass = generateValue(_genMass);
+  if(useMass) {
+    generateValues(_genMass,n,&_bMass[0]);
+  }
+  else {
+    for (int i=0; i<n; i++) {
+      _bMass[i] = ParticleDb::Instance()->Mass(int(_bCode[i]));
     }
+  }
+
+  if(useY())        generateValues(_genY    ,n,&_bPolar[0]);
+  else if(useEta()) generateValues(_genEta  ,n,&_bPolar[0]);
+  else              generateValues(_genTheta,n,&_bPolar[0]);
+
+  generateValues(_genPhi,n,&_bPhi[0]);
+
+  if(UsePt && _usePtHist.value()) {
+    _ptHist.shootArray(engine,n,&_bMom[0]);
+  }
+  else {
+    generateValues(UsePt ? _genPt : _genMom,n,&_bMom[0]);
+  }
+					// histogram variables replace the
+					// ones drawn above
+  if (!_hist.empty()) {
+    _bHistX.resize(n);
+    _bHistY.resize(n);
+    _hist.shootArray(engine,n,&_bHistX[0],&_bHistY[0]);
+    int var[2] = { _histVarX, _histVarY };
+    for (int k=0; k<_hist.dim(); k++) {
+      std::vector<double>& v = (k == 0) ? _bHistX : _bHistY;
+      if      (var[k] == HIST_PHI)              _bPhi.swap(v);
+      else if (var[k] == HIST_PT  || 
+	       var[k] == HIST_P)                _bMom.swap(v);
+      else                                      _bPolar.swap(v);
+    }
+  }
+
+  for (int i=0; i<n; i++) {
+    int code = int(_bCode[i]);
+    mass = _bMass[i];
 
     if(useY()) {
-      eta = generateValue(_genY);
+      eta = _bPolar[i];
     }
     else if(useEta()) {
-      eta   = generateValue(_genEta);
+      eta   = _bPolar[i];
       theta = 2.*atan(exp(-eta));
     }
     else {
-      theta = DEGRAD*generateValue(_genTheta);
+      theta = DEGRAD*_bPolar[i];
     }
-					// Generate Phi
 
-    phi = DEGRAD*generateValue(_genPhi);
+    phi = DEGRAD*_bPhi[i];
 					// Generate energy or Et
     if(UsePt) {
-      if(_usePtHist.value()) { 
-	pt = generatePtUsingHist(); 
-	if (verbose()) Plot("pt", (float)pt, _nbinPt.value(),  
-			    (float)_lowPt.value(),
-			    (float)_highPt.value());
+      pt = _bMom[i];
+      if(_usePtHist.value() && verbose()) { 
+	if (_hPt < 0) _hPt = histHandle("pt", _nbinPt.value(),
+					(float)_lowPt.value(),
+					(float)_highPt.value());
+	fill(_hPt, (float)pt);
       }
-      else {
-	pt   = generateValue(_genPt); }
       if (useY()) {
         double transverseMass = sqrt(pt*pt + mass*mass);
         theta = atan((pt/(transverseMass*sinh(eta))));
@@ -363,7 +418,7 @@ int FakeEv::callGenerator(AbsEvent* event) {
       p    = pt/sin(theta);
     }
     else {
-      p    = generateValue(_genMom);
+      p    = _bMom[i];
       if (useY()) {
         double transverseMass = sqrt(p*p + mass*mass)/cosh(eta);
         theta = atan( sqrt(transverseMass*transverseMass - mass*mass)/(transverseMass*sinh(eta)));
@@ -375,7 +430,9 @@ int FakeEv::callGenerator(AbsEvent* event) {
     px     = pt*cos(phi);
     py     = pt*sin(phi);
     pz     = p*cos(theta);
-
+//-----------------------------------------------------------------------------
+// add particle to /HEPEVT/
+//-----------------------------------------------------------------------------
     Hepevt_t* hepevt = CdfHepevt::Instance()->HepevtPtr();
 
     hepevt->IDHEP[i]     = ParticleDb::Instance()->ParticlePdgCode(code);
@@ -558,6 +615,44 @@ string FakeEvCommand::description() const {
 
 //_____________________________________________________________________________
 AppResult FakeEv::genBeginRun(AbsEvent* run) {
+					// (re)load the histogram when the
+					// file changed
+  if (_histFile.value() == _histLoaded) return AppResult::OK;
+  _hist.clear();
+  _histLoaded = _histFile.value();
+  if (_histLoaded.empty()) return AppResult::OK;
+
+  if (_hist.read(_histLoaded)) {
+    ERRLOG(ELabort,"[FAKE_EVENT_HIST]")
+      << "FAKE_EVENT: can't use histogram file " << _histLoaded << endmsg;
+    return AppResult::ERROR;
+  }
+  _histVarX = _histVariable(_histX.value());
+  _histVarY = (_hist.dim() == 2) ? _histVariable(_histY.value()) : HIST_NONE;
+  int var[2] = { _histVarX, _histVarY };
+  for (int k=0; k<_hist.dim(); k++) {
+					// must be one of the variables in use
+    int v = var[k];
+    bool ok = ( v == HIST_PHI ) ||
+              ( v == HIST_PT    &&  UsePt ) || ( v == HIST_P   && !UsePt ) ||
+              ( v == HIST_ETA   && useEta() ) || ( v == HIST_Y && useY() ) ||
+              ( v == HIST_THETA && useTheta() );
+    if (!ok) {
+      ERRLOG(ELabort,"[FAKE_EVENT_HIST]")
+	<< "FAKE_EVENT: histogram variable \""
+	<< (k == 0 ? _histX.value() : _histY.value()) 
+	<< "\" is not one of the generated ones" << endmsg;
+      return AppResult::ERROR;
+    }
+  }
+  if (_hist.dim() == 2 && _histVarX == _histVarY) {
+    ERRLOG(ELabort,"[FAKE_EVENT_HIST]")
+      << "FAKE_EVENT: histX and histY are the same variable" << endmsg;
+    return AppResult::ERROR;
+  }
+  std::cout << " FAKE_EVENT: " << _hist.dim() << "D histogram of " 
+	    << _hist.nCells() << " cells read from " << _histLoaded 
+	    << std::endl;
   return AppResult::OK;
 }
 
@@ -572,6 +667,8 @@ AppResult FakeEv::genBeginJob() {
   if ( !rn->isReadingFromFile() ) {
     rn->SetEngineSeeds(_randomSeed1.value(), _randomSeed2.value(),FakeEv::genId);
   }
+  FakeEv::fakeEvEngine = rn->GetEngine("FAKE_EVENT");
+
   if (PolarChoice == NOCHOICE) {
     std::cout << " FAKE_EVENT: No Choice of ETA/THETA/Y" 
 	      << std::endl << " Setting default to ETA " << std::endl; 
@@ -592,13 +689,17 @@ AppResult FakeEv::genBeginJob() {
       return AppResult::ERROR;
     }
     double min=0,max=0;
-    int j = 0;
+    std::vector<double> edges, val;
     for (AbsParmList<double>::ConstIterator i=_valPt.begin();
 	 i != _valPt.end(); i++) {
       min=min <= (*i) ? min : (*i);
       max=max >= (*i) ? max : (*i);      
-      _myValPt[j]=(*i);
-      j++;
+      val.push_back(*i);
+    }
+    val.resize(_nbinPt.value(),0.);
+    double dpt = (_highPt.value()-_lowPt.value())/_nbinPt.value();
+    for (int i=0; i<=_nbinPt.value(); i++) {
+      edges.push_back(_lowPt.value()+i*dpt);
     }
     if (min<0.) { 
       std::cout << " FAKE_EVENT: usePtHist is used; \n Tcl error: negative Pt value in the histogram .\n";
@@ -608,7 +709,11 @@ AppResult FakeEv::genBeginJob() {
       std::cout << " FAKE_EVENT: usePtHist is used; \n Tcl error: zero Pt histogram .\n";
       return AppResult::ERROR;
     }
-    
+    if (_ptHist.init(edges,std::vector<double>(),val)) {
+      std::cout << " FAKE_EVENT: usePtHist is used; \n Tcl error: can't build the Pt histogram table .\n";
+      return AppResult::ERROR;
+    }
+
   }
   return AppResult::OK;
 }
@@ -620,7 +725,7 @@ AppResult FakeEv::genEndJob() {
     
 float FakeEv::generateValue(const GenPars& pars) const {
   double a, b, p, tmp, z, val;
-  HepRandomEngine* engine = CdfRn::Instance()->GetEngine("FAKE_EVENT");
+  HepRandomEngine* engine = FakeEv::fakeEvEngine;
   switch (pars.mode()) {
   case 1: // Gaussian
     if (!pars.sigma())
@@ -731,9 +836,51 @@ void FakeEv::GenPars::print(std::ostream& os) const {
 }
 
 double FakeEv::generatePtUsingHist() {
-//  double ret;
-  double* val = _myValPt;
-  HepRandomEngine* engine = CdfRn::Instance()->GetEngine("FAKE_EVENT");
-  return CdfRn::CdfHrndm1(_lowPt.value(),_highPt.value(),
-			  _nbinPt.value(),val,engine);
+  double pt, y;
+  _ptHist.shoot(FakeEv::fakeEvEngine,pt,y);
+  return pt;
+}
+
+//------------------------------------------------------------------------------
+// n values of one variable, same numbers as n calls of generateValue
+//------------------------------------------------------------------------------
+void FakeEv::generateValues(const GenPars& pars, int n, double* out) const {
+  GenValueBatch::Shape shape = GenValueBatch::OTHER;
+  if (pars.mode() == 1)      shape = GenValueBatch::GAUSSIAN;
+  else if (pars.mode() == 2) shape = GenValueBatch::FLAT;
+  if (!GenValueBatch::shootArray(FakeEv::fakeEvEngine,shape,n,out,
+                                 pars.mean(),pars.sigma(),
+                                 pars.min(),pars.max())) {
+    for (int i=0; i<n; i++) out[i] = generateValue(pars);
+  }
+}
+
+void FakeEv::_initializeHistTalkTo(void) {
+
+  _HistMenu.initialize("HistMenu",this);
+  _HistMenu.initTitle("FakeEvent histogram file menu");
+  commands()->append(&_HistMenu);
+
+  _histFile.addDescription(
+"      \t\t\tText file with a 1D or 2D histogram (x/y bin edges, w weights)\n\t\t\tof the generated variables, read at beginRun (default none)");
+  _histX.addDescription(
+"      \t\t\tVariable of the first axis: PT, P, ETA, THETA, Y or PHI (PT);\n\t\t\tTHETA and PHI edges in degrees");
+  _histY.addDescription(
+"      \t\t\tVariable of the second axis of a 2D histogram");
+
+  _HistMenu.commands()->append(&_histFile);
+  _HistMenu.commands()->append(&_histX);
+  _HistMenu.commands()->append(&_histY);
+}
+
+int FakeEv::_histVariable(const std::string& name) const {
+  std::string v(name);
+  for (unsigned i=0; i<v.size(); i++) v[i] = toupper(v[i]);
+  if (v == "PT")    return HIST_PT;
+  if (v == "P")     return HIST_P;
+  if (v == "ETA")   return HIST_ETA;
+  if (v == "THETA") return HIST_THETA;
+  if (v == "Y")     return HIST_Y;
+  if (v == "PHI")   return HIST_PHI;
+  return HIST_NONE;
 }
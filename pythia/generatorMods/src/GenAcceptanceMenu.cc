@@ -0,0 +1,148 @@
+//--------------------------------------------------------------------
+// GenAcceptanceMenu.cc
+//
+// generator level acceptance cuts on /HEPEVT/
+//
+
+#include "generatorMods/GenAcceptanceMenu.hh"
+
+#include <math.h>
+#include <stdlib.h>
+#include <iostream>
+
+GenAcceptanceMenu::GenAcceptanceMenu( AppModule* target,
+				      std::string menuName,
+				      std::string title)
+  :
+  APPMenu(),
+  _enable       ("enable",       target, false),
+  _status       ("status",       target, 1),
+  _nLeptons     ("nLeptons",     target, 0),
+  _leptonPtMin  ("leptonPtMin",  target, 0.),
+  _leptonEtaMax ("leptonEtaMax", target, 999.),
+  _requirePdg   ("requirePdg",   target, 0),
+  _visMassMin   ("visMassMin",   target, 0.),
+  _visMassMax   ("visMassMax",   target, 0.),
+  _visEtaMax    ("visEtaMax",    target, 999.),
+  _maxTries     ("maxTries",     target, 0),
+  _title(title),
+  _nTries(0),
+  _nAccepted(0),
+  _nForced(0)
+{
+  initialize(menuName.c_str(),target);
+  initTitle(title.c_str());
+
+  _enable.addDescription(
+		"      \t\t\tApply the acceptance cuts, default false");
+  _status.addDescription(
+		"      \t\t\tISTHEP of the particles used by the cuts, 0 = all, default 1");
+  _nLeptons.addDescription(
+		"      \t\t\tMinimal number of e/mu passing leptonPtMin/leptonEtaMax");
+  _leptonPtMin.addDescription(
+		"      \t\t\tLepton pt threshold (GeV)");
+  _leptonEtaMax.addDescription(
+		"      \t\t\tLepton |eta| limit");
+  _requirePdg.addDescription(
+		"      \t\t\t|PDG code| required in the record, 0 = none");
+  _visMassMin.addDescription(
+		"      \t\t\tLower limit on the visible mass (GeV), 0 = none");
+  _visMassMax.addDescription(
+		"      \t\t\tUpper limit on the visible mass (GeV), 0 = none");
+  _visEtaMax.addDescription(
+		"      \t\t\t|eta| limit of particles entering the visible mass");
+  _maxTries.addDescription(
+		"      \t\t\tMaximal number of tries per event, 0 = no limit");
+
+  commands()->append(&_enable);
+  commands()->append(&_status);
+  commands()->append(&_nLeptons);
+  commands()->append(&_leptonPtMin);
+  commands()->append(&_leptonEtaMax);
+  commands()->append(&_requirePdg);
+  commands()->append(&_visMassMin);
+  commands()->append(&_visMassMax);
+  commands()->append(&_visEtaMax);
+  commands()->append(&_maxTries);
+}
+
+bool GenAcceptanceMenu::accept(const HEPEVT& hep) {
+  if ( !_enable.value() ) return true;
+  _nTries++;
+  if ( !pass(hep) ) return false;
+  _nAccepted++;
+  return true;
+}
+
+GenAcceptanceMenu::Decision 
+GenAcceptanceMenu::decide(const HEPEVT& hep, int nRejected) {
+  if ( accept(hep) ) return ACCEPTED;
+  if ( _maxTries.value() > 0 && nRejected+1 >= _maxTries.value() ) {
+    _nForced++;
+    return FORCED;
+  }
+  return REJECTED;
+}
+
+bool GenAcceptanceMenu::pass(const HEPEVT& hep) const {
+
+  const int    status    = _status.value();
+  const int    nLepMin   = _nLeptons.value();
+  const double ptMin2    = _leptonPtMin.value()*_leptonPtMin.value();
+  const double lepEtaMax = _leptonEtaMax.value();
+  const int    pdg       = abs(_requirePdg.value());
+  const double mMin      = _visMassMin.value();
+  const double mMax      = _visMassMax.value();
+  const double visEtaMax = _visEtaMax.value();
+  const bool   useMass   = ( mMin > 0. || mMax > 0. );
+
+  int    nLep     = 0;
+  bool   foundPdg = ( pdg == 0 );
+  double sum[4]   = { 0., 0., 0., 0. };
+
+  for ( int i=0; i<hep.NHEP; i++ ) {
+    if ( status && hep.ISTHEP[i] != status ) continue;
+    int id = abs(hep.IDHEP[i]);
+    if ( id == pdg ) foundPdg = true;
+
+    const double* p = hep.PHEP[i];
+    double pt2 = p[0]*p[0] + p[1]*p[1];
+    double eta = 0.;
+    if ( pt2 > 0. ) {
+      eta = asinh(p[2]/sqrt(pt2));
+    }
+    else {
+      eta = ( p[2] >= 0. ) ? 999. : -999.;
+    }
+
+    if ( (id == 11 || id == 13) &&
+	 pt2 > ptMin2 && fabs(eta) < lepEtaMax ) nLep++;
+
+    if ( useMass &&
+	 id != 12 && id != 14 && id != 16 &&
+	 fabs(eta) < visEtaMax ) {
+      for ( int k=0; k<4; k++ ) sum[k] += p[k];
+    }
+  }
+
+  if ( nLep < nLepMin ) return false;
+  if ( !foundPdg      ) return false;
+  if ( useMass ) {
+    double m2 = sum[3]*sum[3] - sum[0]*sum[0] - sum[1]*sum[1] - sum[2]*sum[2];
+    double m  = m2 > 0. ? sqrt(m2) : 0.;
+    if ( mMin > 0. && m < mMin ) return false;
+    if ( mMax > 0. && m > mMax ) return false;
+  }
+  return true;
+}
+
+void GenAcceptanceMenu::print(std::ostream& os, const char* who) const {
+  os << " " << who << ": " << _title << ": "
+     << _nAccepted << " accepted / " << _nTries << " tries";
+  if ( _nTries ) os << " = " << efficiency();
+  os << std::endl;
+  if ( _nForced ) {
+    os << " " << who << ": " << _nForced << " events failing the cuts kept"
+       << " after maxTries, not in the efficiency" << std::endl;
+  }
+}
@@ -0,0 +1,153 @@
+//--------------------------------------------------------------------------
+// GenCacheInputModule
+//
+// replays generator level events from a GenEventCache file
+//
+//------------------------------------------------------------------------
+#include "generatorMods/GenCacheInputModule.hh"
+#include "generatorMods/GenOutputManager.hh"
+#include "generatorMods/HepevtPool.hh"
+
+#include <iostream>
+
+#include "stdhep_i/CdfHepevt.hh"
+#include "stdhep_i/Hepevt.hh"
+#include "SimulationObjects/MVTX_StorableBank.hh"
+#include "HeaderObjects/LRIH_StorableBank.hh"
+#include "Edm/ConstHandle.hh"
+#include "Edm/EventRecord.hh"
+#include "Framework/APPFramework.hh"
+#include "ErrorLogger_i/gERRLOG.hh"
+
+const char* GenCacheInputModule::genId = "GenCacheInput";
+
+//______________________________________________________________________________
+GenCacheInputModule::GenCacheInputModule(const char* const theName,
+					 const char* const theDescription)
+  : AppModule(theName, theDescription),
+    _fileName("CacheFile", this, ""),
+    _firstEvent("FirstEvent", this, 0),
+    _restoreVertices("RestoreVertices", this, true),
+    _checkLRIH("CheckLRIH", this, true),
+    _events(0),
+    _interactions(0),
+    _badRecords(0),
+    _lrihMismatches(0)
+{
+  commands()->append(&_fileName);
+  commands()->append(&_firstEvent);
+  commands()->append(&_restoreVertices);
+  commands()->append(&_checkLRIH);
+  _fileName.addDescription("Event cache written by GenOutputManager (CacheFile talk-to)");
+  _firstEvent.addDescription("Index of the first cached event to replay (default 0)");
+  _restoreVertices.addDescription("Put the cached primary vertices in MVTX instead of letting\nGenPrimVertModule smear new ones (default true)");
+  _checkLRIH.addDescription("Reject events whose cached LRIH run/event numbers differ from the\nLRIH of this job; set false to replay under other run numbers (default true)");
+}
+
+//______________________________________________________________________________
+GenCacheInputModule::~GenCacheInputModule()
+{
+}
+
+//______________________________________________________________________________
+AppResult GenCacheInputModule::beginJob(AbsEvent* event)
+{
+  if ( _reader.open(_fileName.value()) ) {
+    ERRLOG(ELabort,"[GEN_CACHE_OPEN]")
+      << "GenCacheInput: can't open event cache " << _fileName.value() 
+      << endmsg;
+    return AppResult::ERROR;
+  }
+  std::cout << "GenCacheInput: " << _reader.nEvents() << " events in "
+	    << _fileName.value() << std::endl;
+  if ( _firstEvent.value() < 0 || _firstEvent.value() >= _reader.nEvents() ) {
+    ERRLOG(ELerror,"[GEN_CACHE_FIRST]")
+      << "GenCacheInput: no event " << _firstEvent.value() << " in "
+      << _fileName.value() << endmsg;
+  }
+  _reader.seek(_firstEvent.value());
+  return AppResult::OK;
+}
+
+//______________________________________________________________________________
+AppResult GenCacheInputModule::event(AbsEvent* event)
+{
+  while ( true ) {
+    if ( _reader.atEnd() ) {
+      ERRLOG(ELwarning,"[GEN_CACHE_END]")
+	<< "GenCacheInput: end of " << _fileName.value() << " after "
+	<< _events << " events" << endmsg;
+      framework( )->requestStop( );
+      return AppResult::ERROR;
+    }
+    if ( _reader.readNext() == 0 ) break;
+    ERRLOG(ELerror,"[GEN_CACHE_READ]")
+      << "GenCacheInput: skipping unreadable record " << _reader.next()-1
+      << " of " << _fileName.value() << endmsg;
+    _badRecords++;
+  }
+					// cached run/event against this job's
+					// LRIH (GenInputManager); records
+					// written without LRIH have run 0
+  EventRecord::ConstIterator it(event, "LRIH_StorableBank");
+  if ( _reader.run() != 0 && it.is_valid() ) {
+    ConstHandle<LRIH_StorableBank> lrih(it);
+    if ( lrih->run_number()     != _reader.run() ||
+	 lrih->trigger_number() != _reader.event() ) {
+      _lrihMismatches++;
+      if ( _checkLRIH.value() ) {
+	ERRLOG(ELerror,"[GEN_CACHE_LRIH]")
+	  << "GenCacheInput: record " << _reader.next()-1 << " is run "
+	  << _reader.run() << " event " << _reader.event() << ", LRIH says run "
+	  << lrih->run_number() << " event " << lrih->trigger_number()
+	  << endmsg;
+	return AppResult::ERROR;
+      }
+    }
+  }
+
+  CdfHepevt* hepevt = CdfHepevt::Instance();
+  for ( int k=0; k<_reader.nInteractions(); k++ ) {
+    _reader.fillInteraction(k, *hepevt->HepevtPtr(), *hepevt->Hepev4Ptr());
+    if ( GenOutputManager::streamOutput() ) {
+      GenOutputManager::writeBanks(event);
+    } else {
+      hepevt->contentHepevt().push_back( 
+        HepevtPool::Instance()->acquire( *hepevt->HepevtPtr(), 
+					 *hepevt->Hepev4Ptr() ));
+    }
+    hepevt->clearCommon();
+    _interactions++;
+  }
+					// one vertex per interaction in one
+					// MVTX bank, as GenPrimVertModule
+					// writes it, else (e.g. min-bias not
+					// cached) let it smear
+  int nv = _reader.nVertices();
+  if ( _restoreVertices.value() && nv > 0 && nv == _reader.nInteractions() ) {
+    MVTX_StorableBank* mvtx = new MVTX_StorableBank(event,nv);
+    for ( int i=0; i<nv; i++ ) {
+      double v[4];
+      _reader.vertex(i, v);
+      for ( int j=0; j<4; j++ ) mvtx->rw(4*i+j+1) = v[j];
+    }
+  }
+  _events++;
+  return AppResult::OK;
+}
+
+//______________________________________________________________________________
+AppResult GenCacheInputModule::endJob(AbsEvent* event)
+{
+  std::cout << "GenCacheInput: " << _events << " events, " 
+	    << _interactions << " interactions replayed from "
+	    << _fileName.value();
+  if ( _badRecords ) std::cout << ", " << _badRecords << " bad records skipped";
+  if ( _lrihMismatches ) {
+    std::cout << ", " << _lrihMismatches << " with other LRIH run/event"
+	      << ( _checkLRIH.value() ? " rejected" : "" );
+  }
+  std::cout << std::endl;
+  _reader.close();
+  return AppResult::OK;
+}
@@ -0,0 +1,25 @@
+//--------------------------------------------------------------------------
+// GenDecayKernel
+//
+// batched Lorentz boost on structure-of-arrays momenta
+//
+//------------------------------------------------------------------------
+#include "generatorMods/GenDecayKernel.hh"
+
+//______________________________________________________________________________
+void GenDecayKernel::boost(const double beta[4], Momenta& p, int first, int n)
+{
+  const double bx = beta[0], by = beta[1], bz = beta[2], g = beta[3];
+  double* px = &p.px[first];
+  double* py = &p.py[first];
+  double* pz = &p.pz[first];
+  double* e  = &p.e [first];
+  for ( int i=0; i<n; i++ ) {
+    double bp  = bx*px[i]+by*py[i]+bz*pz[i];
+    double bpp = (bp*g/(g+1.)-e[i])*g;
+    px[i] = px[i]+bx*bpp;
+    py[i] = py[i]+by*bpp;
+    pz[i] = pz[i]+bz*bpp;
+    e [i] = g*(e[i]-bp);
+  }
+}
@@ -0,0 +1,391 @@
+//--------------------------------------------------------------------------
+// GenEventCache
+//
+// compressed, indexed generator level event cache
+//
+//------------------------------------------------------------------------
+#include <string.h>
+#include <zlib.h>
+#include <iostream>
+
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/GenEventCache.hh"
+
+namespace {
+
+  const char   headerMagic [8] = { 'G','E','N','C','A','C','H','1' };
+  const char   trailerMagic[8] = { 'G','E','N','C','I','D','X','1' };
+  const int    cacheVersion    = 3;
+  const long   trailerSize     = 2*sizeof(long long) + 8;
+  const long   headerSize      = 8 + 3*sizeof(int);
+  const size_t eventHeadSize   = 4*sizeof(int);
+					// far above any real event, protects
+					// against corrupt lengths
+  const unsigned int maxRecordSize = 1u << 30;
+
+  inline void put(std::vector<char>& buf, const void* p, size_t n) {
+    const char* c = (const char*) p;
+    buf.insert(buf.end(), c, c+n);
+  }
+
+  inline void get(const std::vector<char>& buf, size_t& pos, void* p, size_t n) {
+    if ( n ) memcpy(p, &buf[pos], n);
+    pos += n;
+  }
+
+  inline int rows(const HEPEVT& hep) {
+    const int nmax = sizeof(hep.ISTHEP)/sizeof(hep.ISTHEP[0]);
+    int n = hep.NHEP;
+    if ( n < 0    ) n = 0;
+    if ( n > nmax ) n = nmax;
+    return n;
+  }
+}
+
+//______________________________________________________________________________
+GenEventCacheWriter::GenEventCacheWriter()
+  : _file(0),
+    _run(0),
+    _event(0),
+    _nInteractions(0),
+    _level(6),
+    _bytesRaw(0.),
+    _bytesDisk(0.)
+{
+  _raw.resize(eventHeadSize);
+}
+
+//______________________________________________________________________________
+GenEventCacheWriter::~GenEventCacheWriter()
+{
+  close();
+}
+
+//______________________________________________________________________________
+int GenEventCacheWriter::open(const std::string& fileName, int level)
+{
+  close();
+  _file = fopen(fileName.c_str(), "wb");
+  if ( !_file ) {
+    ERRLOG(ELerror,"[GEN_CACHE_OPEN]")
+      << "GenEventCacheWriter: can't open " << fileName << endmsg;
+    return -1;
+  }
+  _level = level;
+  _raw.resize(eventHeadSize);
+  _vertices.clear();
+  _run = _event = 0;
+  _nInteractions = 0;
+  int sizes[3] = { cacheVersion, (int) sizeof(HEPEVT), (int) sizeof(HEPEV4) };
+  fwrite(headerMagic, 1, 8, _file);
+  fwrite(sizes, sizeof(int), 3, _file);
+  _offsets.clear();
+  _bytesRaw = _bytesDisk = headerSize;
+  return 0;
+}
+
+//______________________________________________________________________________
+void GenEventCacheWriter::addInteraction(const HEPEVT& hep, const HEPEV4& hep4)
+{
+  int n = rows(hep);
+  put(_raw, &n             , sizeof(n));
+  put(_raw, &hep.NEVHEP    , sizeof(hep.NEVHEP));
+  put(_raw, &hep4.EVENTWEIGHTLH, sizeof(hep4.EVENTWEIGHTLH));
+  put(_raw, &hep4.ALPHAQEDLH   , sizeof(hep4.ALPHAQEDLH));
+  put(_raw, &hep4.ALPHAQCDLH   , sizeof(hep4.ALPHAQCDLH));
+  put(_raw, hep4.SCALELH       , sizeof(hep4.SCALELH));
+  put(_raw, &hep4.IDRUPLH      , sizeof(hep4.IDRUPLH));
+  put(_raw, hep.ISTHEP , n*sizeof(hep.ISTHEP[0]));
+  put(_raw, hep.IDHEP  , n*sizeof(hep.IDHEP [0]));
+  put(_raw, hep.JMOHEP , n*sizeof(hep.JMOHEP[0]));
+  put(_raw, hep.JDAHEP , n*sizeof(hep.JDAHEP[0]));
+  put(_raw, hep.PHEP   , n*sizeof(hep.PHEP  [0]));
+  put(_raw, hep.VHEP   , n*sizeof(hep.VHEP  [0]));
+  put(_raw, hep4.SPINLH      , n*sizeof(hep4.SPINLH[0]));
+  put(_raw, hep4.ICOLORFLOWLH, n*sizeof(hep4.ICOLORFLOWLH[0]));
+  _nInteractions++;
+}
+
+//______________________________________________________________________________
+void GenEventCacheWriter::setVertices(int nv, const double* xyzt)
+{
+  _vertices.assign(xyzt, xyzt + 4*(nv > 0 ? nv : 0));
+}
+
+//______________________________________________________________________________
+void GenEventCacheWriter::setRunEvent(int run, int event)
+{
+  _run   = run;
+  _event = event;
+}
+
+//______________________________________________________________________________
+int GenEventCacheWriter::writeEvent()
+{
+  if ( !_file ) return -1;
+
+  int head[4] = { _run, _event, _nInteractions, (int) _vertices.size()/4 };
+  memcpy(&_raw[0], head, sizeof(head));
+  if ( !_vertices.empty() ) {
+    put(_raw, &_vertices[0], _vertices.size()*sizeof(double));
+  }
+
+  uLongf zlen = compressBound(_raw.size());
+  if ( _zbuf.size() < zlen ) _zbuf.resize(zlen);
+  int rc = compress2(&_zbuf[0], &zlen, (const Bytef*) &_raw[0],
+		     _raw.size(), _level);
+  if ( rc != Z_OK ) {
+    ERRLOG(ELerror,"[GEN_CACHE_WRITE]")
+      << "GenEventCacheWriter: zlib error " << rc
+      << " for run " << _run << " event " << _event << endmsg;
+    _raw.resize(eventHeadSize);
+    _vertices.clear();
+    _run = _event = 0;
+    _nInteractions = 0;
+    return -1;
+  }
+
+  unsigned int lengths[2] = { (unsigned int) zlen, (unsigned int) _raw.size() };
+  _offsets.push_back( ftello(_file) );
+  fwrite(lengths, sizeof(unsigned int), 2, _file);
+  fwrite(&_zbuf[0], 1, zlen, _file);
+  _bytesRaw  += _raw.size();
+  _bytesDisk += zlen + sizeof(lengths);
+
+  _raw.resize(eventHeadSize);
+  _vertices.clear();
+  _run = _event = 0;
+  _nInteractions = 0;
+  return ferror(_file) ? -1 : 0;
+}
+
+//______________________________________________________________________________
+int GenEventCacheWriter::close()
+{
+  if ( !_file ) return 0;
+
+  long long indexOffset = ftello(_file);
+  long long nev         = _offsets.size();
+  if ( nev ) fwrite(&_offsets[0], sizeof(long long), nev, _file);
+  fwrite(&nev        , sizeof(nev), 1, _file);
+  fwrite(&indexOffset, sizeof(indexOffset), 1, _file);
+  fwrite(trailerMagic, 1, 8, _file);
+
+  int rc = ferror(_file) ? -1 : 0;
+  fclose(_file);
+  _file = 0;
+  return rc;
+}
+
+//______________________________________________________________________________
+GenEventCacheReader::GenEventCacheReader()
+  : _file(0),
+    _vertexOffset(0),
+    _nVertices(0),
+    _next(0),
+    _run(0),
+    _event(0)
+{ }
+
+//______________________________________________________________________________
+GenEventCacheReader::~GenEventCacheReader()
+{
+  close();
+}
+
+//______________________________________________________________________________
+void GenEventCacheReader::close()
+{
+  if ( _file ) fclose(_file);
+  _file = 0;
+  _offsets.clear();
+  _interactions.clear();
+  _nVertices = 0;
+  _next = 0;
+  _run = _event = 0;
+}
+
+//______________________________________________________________________________
+int GenEventCacheReader::open(const std::string& fileName)
+{
+  close();
+  _file = fopen(fileName.c_str(), "rb");
+  if ( !_file ) {
+    ERRLOG(ELerror,"[GEN_CACHE_OPEN]")
+      << "GenEventCacheReader: can't open " << fileName << endmsg;
+    return -1;
+  }
+
+  char magic[8];
+  int  sizes[3];
+  if ( fread(magic, 1, 8, _file) != 8 || memcmp(magic, headerMagic, 8) ||
+       fread(sizes, sizeof(int), 3, _file) != 3 ) {
+    ERRLOG(ELerror,"[GEN_CACHE_FORMAT]")
+      << "GenEventCacheReader: " << fileName
+      << " is not a generator event cache" << endmsg;
+    close();
+    return -1;
+  }
+  if ( sizes[0] != cacheVersion ||
+       sizes[1] != (int) sizeof(HEPEVT) || sizes[2] != (int) sizeof(HEPEV4) ) {
+    ERRLOG(ELerror,"[GEN_CACHE_FORMAT]")
+      << "GenEventCacheReader: " << fileName
+      << " was written with a different version or /HEPEVT/ layout" << endmsg;
+    close();
+    return -1;
+  }
+					// index from the trailer ...
+  fseeko(_file, 0, SEEK_END);
+  long long fileSize = ftello(_file);
+  if ( fileSize >= headerSize + trailerSize ) {
+    long long nev, indexOffset;
+    fseeko(_file, fileSize - trailerSize, SEEK_SET);
+    if ( fread(&nev        , sizeof(nev), 1, _file) == 1 &&
+	 fread(&indexOffset, sizeof(indexOffset), 1, _file) == 1 &&
+	 fread(magic, 1, 8, _file) == 8 && !memcmp(magic, trailerMagic, 8) &&
+	 indexOffset + nev*(long long)sizeof(long long) + trailerSize == fileSize ) {
+      _offsets.resize(nev);
+      fseeko(_file, indexOffset, SEEK_SET);
+      if ( nev == 0 ||
+	   fread(&_offsets[0], sizeof(long long), nev, _file) == (size_t) nev ) {
+	return 0;
+      }
+    }
+  }
+					// ... or by walking the records
+  ERRLOG(ELwarning,"[GEN_CACHE_INDEX]")
+    << "GenEventCacheReader: no index in " << fileName
+    << ", scanning records" << endmsg;
+  return scanRecords(headerSize);
+}
+
+//______________________________________________________________________________
+int GenEventCacheReader::scanRecords(long long start)
+{
+  _offsets.clear();
+  long long pos = start;
+  unsigned int lengths[2];
+  fseeko(_file, pos, SEEK_SET);
+  while ( fread(lengths, sizeof(unsigned int), 2, _file) == 2 ) {
+    long long end = pos + sizeof(lengths) + lengths[0];
+    if ( fseeko(_file, end, SEEK_SET) ) break;
+					// a truncated last record is dropped
+    fseeko(_file, 0, SEEK_END);
+    if ( ftello(_file) < end ) break;
+    _offsets.push_back(pos);
+    pos = end;
+    fseeko(_file, pos, SEEK_SET);
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int GenEventCacheReader::readEvent(long i)
+{
+  _interactions.clear();
+  _nVertices = 0;
+  _run = _event = 0;
+  if ( !_file || i < 0 || i >= (long) _offsets.size() ) return -1;
+
+  unsigned int lengths[2];
+  if ( fseeko(_file, _offsets[i], SEEK_SET) ||
+       fread(lengths, sizeof(unsigned int), 2, _file) != 2 ||
+       lengths[0] == 0 || lengths[0] > maxRecordSize ||
+       lengths[1] < eventHeadSize || lengths[1] > maxRecordSize ) {
+    ERRLOG(ELerror,"[GEN_CACHE_READ]")
+      << "GenEventCacheReader: bad record header " << i << endmsg;
+    return -1;
+  }
+  if ( _zbuf.size() < lengths[0] ) _zbuf.resize(lengths[0]);
+  if ( fread(&_zbuf[0], 1, lengths[0], _file) != lengths[0] ) return -1;
+
+  _raw.resize(lengths[1]);
+  uLongf rawlen = lengths[1];
+  if ( uncompress((Bytef*) &_raw[0], &rawlen, &_zbuf[0], lengths[0]) != Z_OK ||
+       rawlen != lengths[1] ) {
+    ERRLOG(ELerror,"[GEN_CACHE_READ]")
+      << "GenEventCacheReader: corrupted record " << i << endmsg;
+    return -1;
+  }
+
+  size_t pos = 0;
+  int head[4];
+  get(_raw, pos, head, sizeof(head));
+					// remember where each interaction
+					// starts, decode on demand; every
+					// size is checked here so that
+					// fillInteraction can just copy
+  HEPEVT* h  = 0;
+  HEPEV4* h4 = 0;
+  const size_t fixed = sizeof(int) + sizeof(h->NEVHEP)
+    + sizeof(h4->EVENTWEIGHTLH) + sizeof(h4->ALPHAQEDLH)
+    + sizeof(h4->ALPHAQCDLH) + sizeof(h4->SCALELH) + sizeof(h4->IDRUPLH);
+  const size_t row = sizeof(h->ISTHEP[0]) + sizeof(h->IDHEP[0])
+    + sizeof(h->JMOHEP[0]) + sizeof(h->JDAHEP[0])
+    + sizeof(h->PHEP[0])   + sizeof(h->VHEP[0])
+    + sizeof(h4->SPINLH[0]) + sizeof(h4->ICOLORFLOWLH[0]);
+  bool ok = head[2] >= 0 && head[3] >= 0 &&
+    (size_t) head[2] <= (_raw.size()-pos)/fixed;
+  for ( int k=0; ok && k<head[2]; k++ ) {
+    if ( _raw.size()-pos < fixed ) {
+      ok = false;
+      break;
+    }
+    _interactions.push_back(pos);
+    int n;
+    memcpy(&n, &_raw[pos], sizeof(n));
+    if ( n < 0 || n > NMXHEP || (_raw.size()-pos-fixed)/row < (size_t) n ) {
+      ok = false;
+      break;
+    }
+    pos += fixed + n*row;
+  }
+  if ( ok && (_raw.size()-pos) != head[3]*4*sizeof(double) ) ok = false;
+  if ( !ok ) {
+    ERRLOG(ELerror,"[GEN_CACHE_READ]")
+      << "GenEventCacheReader: inconsistent record " << i << endmsg;
+    _interactions.clear();
+    return -1;
+  }
+  _run          = head[0];
+  _event        = head[1];
+  _vertexOffset = pos;
+  _nVertices    = head[3];
+  _next = i+1;
+  return 0;
+}
+
+//______________________________________________________________________________
+void GenEventCacheReader::fillInteraction(int k, HEPEVT& hep, HEPEV4& hep4) const
+{
+  if ( k < 0 || k >= nInteractions() ) {
+    hep.NHEP = 0;
+    return;
+  }
+  size_t pos = _interactions[k];
+  int n;
+  get(_raw, pos, &n, sizeof(n));
+  hep.NHEP = n;
+  get(_raw, pos, &hep.NEVHEP , sizeof(hep.NEVHEP));
+  get(_raw, pos, &hep4.EVENTWEIGHTLH, sizeof(hep4.EVENTWEIGHTLH));
+  get(_raw, pos, &hep4.ALPHAQEDLH   , sizeof(hep4.ALPHAQEDLH));
+  get(_raw, pos, &hep4.ALPHAQCDLH   , sizeof(hep4.ALPHAQCDLH));
+  get(_raw, pos, hep4.SCALELH       , sizeof(hep4.SCALELH));
+  get(_raw, pos, &hep4.IDRUPLH      , sizeof(hep4.IDRUPLH));
+  get(_raw, pos, hep.ISTHEP , n*sizeof(hep.ISTHEP[0]));
+  get(_raw, pos, hep.IDHEP  , n*sizeof(hep.IDHEP [0]));
+  get(_raw, pos, hep.JMOHEP , n*sizeof(hep.JMOHEP[0]));
+  get(_raw, pos, hep.JDAHEP , n*sizeof(hep.JDAHEP[0]));
+  get(_raw, pos, hep.PHEP   , n*sizeof(hep.PHEP  [0]));
+  get(_raw, pos, hep.VHEP   , n*sizeof(hep.VHEP  [0]));
+  get(_raw, pos, hep4.SPINLH      , n*sizeof(hep4.SPINLH[0]));
+  get(_raw, pos, hep4.ICOLORFLOWLH, n*sizeof(hep4.ICOLORFLOWLH[0]));
+}
+
+//______________________________________________________________________________
+void GenEventCacheReader::vertex(int i, double xyzt[4]) const
+{
+  if ( i < 0 || i >= _nVertices ) return;
+  size_t pos = _vertexOffset + i*4*sizeof(double);
+  get(_raw, pos, xyzt, 4*sizeof(double));
+}
@@ -0,0 +1,125 @@
+//--------------------------------------------------------------------------
+// GenFakeRecipes
+//
+// fake events made of particle recipes, one block per recipe
+//
+//------------------------------------------------------------------------
+#include <iostream>
+#include <math.h>
+#include <string.h>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandGaussT.h"
+#include "CLHEP/Random/RandPoisson.h"
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/GenFakeRecipes.hh"
+
+//______________________________________________________________________________
+int GenFakeRecipes::add(int cdfCode, double mean, int poisson, double cone,
+			const char* histFile)
+{
+  if (mean < 0. || cone < 0.) {
+    std::cout << " recipe: negative multiplicity or cone width" << std::endl;
+    return -1;
+  }
+  Recipe r;
+  r.cdfCode  = cdfCode;
+  r.pdgId    = 0;
+  r.mass     = 0.;
+  r.poisson  = poisson;
+  r.mean     = mean;
+  r.cone     = cone;
+  r.histFile = histFile ? histFile : "";
+  _recipes.push_back(r);
+  return 0;
+}
+
+//______________________________________________________________________________
+int GenFakeRecipes::generate(HepRandomEngine* engine, Kinematics& kin,
+			     HEPEVT& hep)
+{
+  int nhep = 0;
+
+  for (unsigned ir=0; ir<_recipes.size(); ir++) {
+    Recipe& r = _recipes[ir];
+    int n = r.poisson ? (int) RandPoisson::shoot(engine,r.mean)
+                      : (int) (r.mean+0.5);
+    if (nhep+n > NMXHEP) {
+      ERRLOG(ELwarning,"[MIX_FAKE_EVENT_RECIPE]")
+	<< "GenFakeRecipes: /HEPEVT/ full, recipe " << ir << " truncated to "
+	<< NMXHEP-nhep << " particles" << endmsg;
+      n = NMXHEP-nhep;
+    }
+    if (n <= 0) continue;
+
+    _bMom.resize(n);
+    _bEta.resize(n);
+    _bPhi.resize(n);
+					// momentum (and polar) variable; an
+					// empty histogram says dim() 1 too
+    bool polarDone = false;
+    if (!r.hist.empty() && r.hist.dim() == 2) {
+      r.hist.shootArray(engine,n,&_bMom[0],&_bEta[0]);
+      polarDone = true;
+    }
+    else if (!r.hist.empty()) {
+      r.hist.shootArray(engine,n,&_bMom[0]);
+    }
+    else {
+      kin.momentum(n,&_bMom[0]);
+    }
+
+    if (r.cone > 0.) {
+      double etaAxis, phiAxis;
+      kin.polar(1,&etaAxis);
+      kin.toEta(1,&etaAxis);
+      kin.phi(1,&phiAxis);
+
+      _bGaus.resize(2*n);
+      RandGaussT::shootArray(engine,2*n,&_bGaus[0],0.,r.cone);
+      for (int i=0; i<n; i++) {
+	_bEta[i] = etaAxis + (polarDone ? _bEta[i] : _bGaus[n+i]);
+	_bPhi[i] = phiAxis + _bGaus[i];
+      }
+    }
+    else {
+      if (!polarDone) kin.polar(n,&_bEta[0]);
+      kin.toEta(n,&_bEta[0]);
+      kin.phi(n,&_bPhi[0]);
+    }
+					// four-momenta
+    double mass = r.mass;
+    _bPhep.resize(5*n);
+    for (int i=0; i<n; i++) {
+      double theta = 2.*atan(exp(-_bEta[i]));
+      double pt, p;
+      if (kin.usePt()) {
+	pt = _bMom[i];
+	p  = pt/sin(theta);
+      }
+      else {
+	p  = _bMom[i];
+	pt = p*sin(theta);
+      }
+      double* v = &_bPhep[5*i];
+      v[0] = pt*cos(_bPhi[i]);
+      v[1] = pt*sin(_bPhi[i]);
+      v[2] = p*cos(theta);
+      v[3] = sqrt(p*p + mass*mass);
+      v[4] = mass;
+    }
+					// block copy into /HEPEVT/
+    for (int i=nhep; i<nhep+n; i++) {
+      hep.ISTHEP[i] = 1;
+      hep.IDHEP [i] = r.pdgId;
+    }
+    memset(&hep.JMOHEP[nhep][0],0,2*n*sizeof(hep.JMOHEP[0][0]));
+    memset(&hep.JDAHEP[nhep][0],0,2*n*sizeof(hep.JDAHEP[0][0]));
+    memcpy(&hep.PHEP  [nhep][0],&_bPhep[0],5*n*sizeof(double));
+    memset(&hep.VHEP  [nhep][0],0,4*n*sizeof(hep.VHEP[0][0]));
+    nhep += n;
+  }
+
+  hep.NHEP = nhep;
+  return 0;
+}
@@ -0,0 +1,46 @@
+//--------------------------------------------------------------------------
+// GenHerwigRecord
+//
+// hard process row of the HERWIG /HEPEVT/ record
+//
+//------------------------------------------------------------------------
+#include <cmath>
+
+#include "generatorMods/GenHerwigRecord.hh"
+
+//______________________________________________________________________________
+void GenHerwigRecord::index(const HEPEVT& hep)
+{
+  _nhep = hep.NHEP;
+  if ( _nhep < 0      ) _nhep = 0;
+  if ( _nhep > NMXHEP ) _nhep = NMXHEP;
+
+  _hardProcess = -1;
+  const int* status = hep.ISTHEP;
+  for ( int i=0; i<_nhep; ++i ) {
+    if ( status[i] == HARDPROCESS ) {
+      _hardProcess = i;
+      return;
+    }
+  }
+}
+
+//______________________________________________________________________________
+double GenHerwigRecord::pthat(const HEPEVT& hep) const
+{
+  int i = hardProcess();
+  if ( i < 0 ) return 0.;
+					// single precision, as HERWIG
+  float px = hep.PHEP[i][0];
+  float py = hep.PHEP[i][1];
+  float pt2 = px*px+py*py;
+  return ( pt2 > 0. ) ? std::sqrt(pt2) : 0.;
+}
+
+//______________________________________________________________________________
+void GenHerwigRecord::fillHepev4(const HEPEVT& hep, HEPEV4& hep4,
+				 double weight) const
+{
+  hep4.EVENTWEIGHTLH = weight;
+  hep4.SCALELH[5]    = pthat(hep);
+}
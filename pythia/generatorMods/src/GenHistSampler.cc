@@ -0,0 +1,179 @@
+//--------------------------------------------------------------------------
+// GenHistSampler
+//
+// alias table sampling of 1D/2D histograms
+//
+//------------------------------------------------------------------------
+#include <fstream>
+#include <sstream>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/GenHistSampler.hh"
+
+//______________________________________________________________________________
+void GenHistSampler::clear()
+{
+  _xEdges.clear();
+  _yEdges.clear();
+  _norm.clear();
+  _prob.clear();
+  _alias.clear();
+}
+
+//______________________________________________________________________________
+int GenHistSampler::init(const std::vector<double>& xEdges,
+			 const std::vector<double>& yEdges,
+			 const std::vector<double>& weights)
+{
+  clear();
+  int nx = int(xEdges.size()) - 1;
+  int ny = yEdges.empty() ? 1 : int(yEdges.size()) - 1;
+  if ( nx < 1 || ny < 1 || int(weights.size()) != nx*ny ) return -1;
+  for ( int i=0; i<nx; i++ ) if ( !(xEdges[i] < xEdges[i+1]) ) return -1;
+  for ( int i=0; i+1<int(yEdges.size()); i++ ) {
+    if ( !(yEdges[i] < yEdges[i+1]) ) return -1;
+  }
+
+  int n = nx*ny;
+  double sum = 0.;
+  for ( int i=0; i<n; i++ ) {
+    if ( weights[i] < 0. ) return -1;
+    sum += weights[i];
+  }
+  if ( sum <= 0. ) return -1;
+
+  _xEdges = xEdges;
+  _yEdges = yEdges;
+  _norm.resize(n);
+  _prob.resize(n);
+  _alias.resize(n);
+					// Vose: split the scaled weights in
+					// small (<1) and large ones, each small
+					// cell is topped up by a large one
+  std::vector<int> small, large;
+  for ( int i=0; i<n; i++ ) {
+    _norm[i]  = weights[i]/sum;
+    _prob[i]  = _norm[i]*n;
+    _alias[i] = i;
+    if ( _prob[i] < 1. ) small.push_back(i);
+    else                 large.push_back(i);
+  }
+  while ( !small.empty() && !large.empty() ) {
+    int s = small.back(); small.pop_back();
+    int l = large.back();
+    _alias[s] = l;
+    _prob [l] = (_prob[l] + _prob[s]) - 1.;
+    if ( _prob[l] < 1. ) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+					// rounding leftovers are full cells
+  for ( unsigned i=0; i<large.size(); i++ ) _prob[large[i]] = 1.;
+  for ( unsigned i=0; i<small.size(); i++ ) _prob[small[i]] = 1.;
+  return 0;
+}
+
+//______________________________________________________________________________
+int GenHistSampler::read(const std::string& fileName)
+{
+  clear();
+  std::ifstream in(fileName.c_str());
+  if ( !in ) {
+    ERRLOG(ELerror,"[GEN_HIST_SAMPLER]")
+      << "GenHistSampler: can't open " << fileName << endmsg;
+    return -1;
+  }
+
+  std::vector<double> x, y, w;
+  std::vector<double>* cur = 0;
+  std::string line, word;
+  while ( std::getline(in,line) ) {
+    std::string::size_type c = line.find('#');
+    if ( c != std::string::npos ) line.erase(c);
+    std::istringstream is(line);
+    while ( is >> word ) {
+      if      ( word == "x" ) cur = &x;
+      else if ( word == "y" ) cur = &y;
+      else if ( word == "w" ) cur = &w;
+      else {
+	std::istringstream iv(word);
+	double v;
+	if ( !cur || !(iv >> v) ) {
+	  ERRLOG(ELerror,"[GEN_HIST_SAMPLER]")
+	    << "GenHistSampler: bad entry \"" << word << "\" in "
+	    << fileName << endmsg;
+	  return -1;
+	}
+	cur->push_back(v);
+      }
+    }
+  }
+  if ( init(x,y,w) ) {
+    ERRLOG(ELerror,"[GEN_HIST_SAMPLER]")
+      << "GenHistSampler: inconsistent histogram in " << fileName
+      << " (" << x.size() << " x edges, " << y.size() << " y edges, "
+      << w.size() << " weights)" << endmsg;
+    return -1;
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int GenHistSampler::cell(double u) const
+{
+  int n = _prob.size();
+  double v = u*n;
+  int k = int(v);
+  if ( k >= n ) k = n-1;
+  return ( v-k < _prob[k] ) ? k : _alias[k];
+}
+
+//______________________________________________________________________________
+void GenHistSampler::shoot(HepRandomEngine* engine, double& x, double& y)
+{
+  shootArray(engine, 1, &x, &y);
+}
+
+//______________________________________________________________________________
+void GenHistSampler::shootArray(HepRandomEngine* engine, int n,
+				double* x, double* y)
+{
+  fill(engine, n, x, y);
+}
+
+//______________________________________________________________________________
+void GenHistSampler::shootArray(HepRandomEngine* engine, int n, double* x)
+{
+  fill(engine, n, x, 0);
+}
+
+//______________________________________________________________________________
+void GenHistSampler::fill(HepRandomEngine* engine, int n, double* x, double* y)
+{
+  if ( n <= 0 ) return;
+  if ( empty() ) {
+    ERRLOG(ELerror,"[GEN_HIST_SAMPLER]")
+      << "GenHistSampler: no histogram, " << n << " zeros returned" << endmsg;
+    for ( int i=0; i<n; i++ ) x[i] = 0.;
+    if ( y ) for ( int i=0; i<n; i++ ) y[i] = 0.;
+    return;
+  }
+  const int nr = ( dim() == 1 ) ? 2 : 3;
+  const int nx = this->nx();
+  _rn.resize(nr*n);
+  RandFlat::shootArray(engine, nr*n, &_rn[0]);
+
+  for ( int i=0; i<n; i++ ) {
+    const double* r = &_rn[nr*i];
+    int c  = cell(r[0]);
+    int ix = c % nx;
+    x[i] = _xEdges[ix] + r[1]*(_xEdges[ix+1]-_xEdges[ix]);
+    if ( nr == 3 && y ) {
+      int iy = c / nx;
+      y[i] = _yEdges[iy] + r[2]*(_yEdges[iy+1]-_yEdges[iy]);
+    }
+  }
+}
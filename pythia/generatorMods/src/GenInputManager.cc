@@ -10,6 +10,7 @@
 
 #include "AbsEnv/AbsEnv.hh"
 #include "generatorMods/GenInputManager.hh"
+#include "generatorMods/GenOutputManager.hh"
 #include "stdhep_i/CdfHepevt.hh"
 #include "Edm/Handle.hh"
 #include "Edm/ConstHandle.hh"
@@ -24,27 +25,47 @@
 #include "Framework/AppStop.hh"
 #include "Framework/AppFrame.hh"
 #include "r_n/CdfRn.hh"
+#include <map>
 
 using namespace std;
 
 GenInputManager::GenInputManager(const char* const theName, 
     const char* const theDescription )
   : APPGenInputModule( theName, theDescription ),
-    _restoreRandomStream("RestoreRandomStream", this, true),
+    _eventNumber(0),
     _runSectionLength("RunSectionLength", this, 1000, 1, 1000000 ),
     _runSectionOffset("RunSectionOffset", this, 0, 0, 1000000 ),
+    _restoreRandomStream("RestoreRandomStream", this, true),
     _lumiWtRunsFromDB("LumiWtRunsFromDB", this, false),
-    _rewriteLRIH("RewriteLRIH", this, false),
-    _eventNumber(0),
-    _mcRun(this), _initialized(false)
+    _mcRun(this),
+    _lumiTableFile("LumiTableFile", this, ""),
+    _lumiTableEvents("LumiTableEvents", this, 0),
+    _lumiTableFirstRun("LumiTableFirstRun", this, 0),
+    _lumiTableLastRun("LumiTableLastRun", this, 0),
+    _lumiTableSeed1("LumiTableSeed1", this, 71324581),
+    _lumiTableSeed2("LumiTableSeed2", this, 5184273),
+    _initialized(false),
+    _rewriteLRIH("RewriteLRIH", this, false)
 {
   commands()->append(&_runSectionLength);
   commands()->append(&_runSectionOffset);
   commands()->append(&_lumiWtRunsFromDB);
+  commands()->append(&_lumiTableFile);
+  commands()->append(&_lumiTableEvents);
+  commands()->append(&_lumiTableFirstRun);
+  commands()->append(&_lumiTableLastRun);
+  commands()->append(&_lumiTableSeed1);
+  commands()->append(&_lumiTableSeed2);
   commands()->append(&_rewriteLRIH);
   _mcRun.appendCommands( commands() );
 
   _rewriteLRIH.addDescription("Change the run number in LRIH of input file.\nThis allows you to change the run number of a file with only GENP info, for example.");
+  _lumiTableFile.addDescription("Local run -> integrated luminosity table (text or makeRunLumiTable output)\nused instead of the DB for luminosity weighted run numbers (default none)");
+  _lumiTableEvents.addDescription("Number of events to distribute over the runs of LumiTableFile,\nin run sections of RunSectionLength events");
+  _lumiTableFirstRun.addDescription("First run of LumiTableFile that may be chosen (default 0: no limit)");
+  _lumiTableLastRun.addDescription("Last run of LumiTableFile that may be chosen (default 0: no limit)");
+  _lumiTableSeed1.addDescription("Seed #1 of the GEN_LUMI_TABLE engine that chooses the runs");
+  _lumiTableSeed2.addDescription("Seed #2 of the GEN_LUMI_TABLE engine that chooses the runs");
 }
 
 GenInputManager::~GenInputManager()
@@ -61,7 +82,10 @@ AppResult GenInputManager::childBeginJob(AbsEvent* event) {
 
   if (! _initialized) {
     _initialized = true;
-    if (_lumiWtRunsFromDB.value()) {
+    if (! _lumiTableFile.value().empty()) {
+      if (! runsFromLumiTable()) return AppResult::ERROR;
+    }
+    else if (_lumiWtRunsFromDB.value()) {
 
       // Calibration manager isn't ready yet, so
       // hijack framework and initialize calibration manager
@@ -94,6 +118,68 @@ AppResult GenInputManager::childBeginJob(AbsEvent* event) {
   return AppResult::OK;
 }
 
+bool
+GenInputManager::runsFromLumiTable() {
+
+  int firstRun = _lumiTableFirstRun.value();
+  int lastRun  = _lumiTableLastRun.value();
+  if ( firstRun && lastRun && firstRun > lastRun ) {
+    ERRLOG(ELerror,"[GEN_LUMI_TABLE]")
+      << "GenInputManager: LumiTableFirstRun " << firstRun
+      << " after LumiTableLastRun " << lastRun << endmsg;
+    return false;
+  }
+  if ( _lumiTable.read(_lumiTableFile.value(),firstRun,lastRun) ) {
+    return false;
+  }
+  if ( _lumiTableEvents.value() <= 0 ) {
+    ERRLOG(ELerror,"[GEN_LUMI_TABLE]")
+      << "GenInputManager: LumiTableEvents must be set with LumiTableFile"
+      << endmsg;
+    return false;
+  }
+
+  // one luminosity weighted run per run section, the sections of a
+  // run are then generated together. The engine is not SIMULATION:
+  // drawing from it here would shift the streams of the generators.
+  CdfRn* rn = CdfRn::Instance();
+  if ( !rn->isReadingFromFile() ) {
+    rn->SetEngineSeeds(_lumiTableSeed1.value(), _lumiTableSeed2.value(),
+		       "GEN_LUMI_TABLE");
+  }
+  HepRandomEngine* engine = rn->GetEngine("GEN_LUMI_TABLE");
+  int length   = _runSectionLength.value();
+  int nsection = (_lumiTableEvents.value() + length - 1) / length;
+  std::map<int,int> sections;
+  for (int i=0; i<nsection; i++) {
+    int run = _lumiTable.shoot(engine);
+    if ( (firstRun && run < firstRun) || (lastRun && run > lastRun) ) {
+      ERRLOG(ELerror,"[GEN_LUMI_TABLE]")
+	<< "GenInputManager: run " << run << " of " << _lumiTableFile.value()
+	<< " outside the valid run range " << firstRun << " - " << lastRun
+	<< endmsg;
+      return false;
+    }
+    sections[run]++;
+  }
+
+  _specifyRangeOfRuns.set(true);
+  _beginRunRequested.set(true);
+  _runInfo.clear();
+  for (std::map<int,int>::const_iterator r = sections.begin(); 
+       r != sections.end(); ++r) {
+    _runInfo.push_back( APPGenRunInfo(r->first, 1, r->second*length) );
+  }
+  _iterRunInfo = _runInfo.begin();
+  _runNumber.set(_iterRunInfo->runNum());
+
+  ERRLOG( ELinfo, "[GEN_LUMI_TABLE]" )
+    << "GenInputManager: " << nsection << " run sections in " 
+    << _runInfo.size() << " of " << _lumiTable.size() << " runs from "
+    << _lumiTableFile.value() << endmsg;
+  return true;
+}
+
 void
 GenInputManager::generateNewRunSection() {
   AppStop* generatedStop = new AppStop( theRecord(), AppStopType::begin_run_section, 0);
@@ -160,6 +246,9 @@ GenInputManager::initEventHeader( )
 
 AppResult GenInputManager::event(AbsEvent* event) {
 
+   // a new event: the event cache record of the previous one is complete
+   GenOutputManager::closeCacheEvent();
+
    if ( runType( ) == LRIH_run_type::monte_carlo_embedded ||
 	(runType( ) == LRIH_run_type::monte_carlo_realistic && _rewriteLRIH.value()) ||
 	(runType( ) == LRIH_run_type::monte_carlo_run && _rewriteLRIH.value()) )
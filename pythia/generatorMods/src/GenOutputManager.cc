@@ -21,8 +21,11 @@
 #include "generatorMods/TauolaModule.hh"
 #include "generatorMods/UnwtModule.hh"
 #include "generatorMods/WGRAD_Module.hh"
+#include "generatorMods/HepevtPool.hh"
+#include "generatorMods/GenEventCache.hh"
 
 #include "stdhep_i/CdfHepevt.hh"
+#include "stdhep_i/CdfHepEvt.hh"
 #include "stdhep_i/Hepevt.hh"
 #include "stdhep_i/Tauevt.hh"
 #include "Edm/Handle.hh"
@@ -31,6 +34,7 @@
 #include "SimulationObjects/TAUG_StorableBank.hh"
 #include "SimulationObjects/HEPG_StorableBank.hh"
 #include "SimulationObjects/HEP4_StorableBank.hh"
+#include "HeaderObjects/LRIH_StorableBank.hh"
 #include "Framework/APPFramework.hh"
 #include "Framework/APPExecNode.hh"
 #include "Framework/APPExecutable.hh"
@@ -40,13 +44,25 @@
 #include <string>
 using namespace std;
 
+bool GenOutputManager::_streamOutput = false;
+GenEventCacheWriter* GenOutputManager::_cache = 0;
+
 GenOutputManager::GenOutputManager(const char* const theName, 
     const char* const theDescription )
   : AppModule( theName, theDescription ),
+    _streamParm("StreamHepg", this, false),
+    _cacheFile("CacheFile", this, ""),
+    _cacheCompression("CacheCompression", this, 6),
     _output(true),
     _stopIt(false),
     here_is_tauola(0)
 {
+  commands()->append(&_streamParm);
+  commands()->append(&_cacheFile);
+  commands()->append(&_cacheCompression);
+  _cacheFile.addDescription("Also write the generator level events to this compact binary cache,\nto be replayed with GenCacheInput (default none)");
+  _cacheCompression.addDescription("zlib level of the event cache, 0-9 (default 6)");
+  _streamParm.addDescription("Let generator modules write HEPG/HEP4 directly from /HEPEVT/\nwhen no decay package or Tauola is enabled (default false: the\nsub-events stay in CdfHepevt::contentHepevt() for downstream modules)");
 }
 
 GenOutputManager::~GenOutputManager()
@@ -162,11 +178,36 @@ AppResult GenOutputManager::beginJob(AbsEvent* event) {
   if ( !_stopIt ) { 
     std::cout << "****| GENERATORS: generator configuration check PASSED |*****" << endl;
   } 
+
+  //-->--> decay packages and Tauola work on the stored Hepevt list,
+  //-->--> without them the banks can be written as events are produced
+  _streamOutput = ( _streamParm.value() && _output && !_stopIt &&
+		    number_of_dec == 0 && !here_is_tauola );
+
+  if ( !_cacheFile.value().empty() && _output && !_stopIt ) {
+    _cache = new GenEventCacheWriter();
+    if ( _cache->open(_cacheFile.value(), _cacheCompression.value()) ) {
+      delete _cache;
+      _cache = 0;
+      ar = AppResult::ERROR;
+    }
+  }
   return ar;
 }
 
 AppResult GenOutputManager::endJob(AbsEvent* event) {
 
+  if ( _cache ) {
+    closeCacheEvent();
+    std::cout << "GenOutputManager: " << _cache->nEvents() 
+	      << " events written to " << _cacheFile.value() << ", "
+	      << _cache->bytesDisk() << " bytes ("
+	      << _cache->bytesRaw() << " uncompressed)" << std::endl;
+    _cache->close();
+    delete _cache;
+    _cache = 0;
+  }
+
   return AppResult::OK;
 }
 
@@ -183,6 +224,21 @@ AppResult GenOutputManager::event(AbsEvent* event) {
   
   CdfHepevt* hepevt = CdfHepevt::Instance();
 
+  if ( _output && _cache ) {
+    // interactions streamed by the generators are already in the cache,
+    // the stored ones (after decay packages) are added here; the record
+    // stays open for the MVTX vertices until the next event starts
+    for ( std::list<Hepevt*>::iterator i = hepevt->contentHepevt().begin();
+	  i !=  hepevt->contentHepevt().end(); ++i ) {
+      _cache->addInteraction( *(*i)->HepevtPtr(), *(*i)->Hepev4Ptr() );
+    }
+    EventRecord::ConstIterator it(event, "LRIH_StorableBank");
+    if ( it.is_valid() ) {
+      ConstHandle<LRIH_StorableBank> lrih(it);
+      _cache->setRunEvent( lrih->run_number(), lrih->trigger_number() );
+    }
+  }
+
   if( _output ) {
 
     std::list<Tauevt*>::iterator itau = hepevt->contentTauevt().begin();
@@ -258,15 +314,78 @@ AppResult GenOutputManager::event(AbsEvent* event) {
       hepevt->clearCommon(); // overkill...
     }
   } else {
+    HepevtPool::Instance()->reclaim(hepevt->contentHepevt());
     hepevt->clear();
     hepevt->clearCommon();
     return AppResult::OK;
   }
+  // banks are written, hand the Hepevt copies back for the next event
+  HepevtPool::Instance()->reclaim(hepevt->contentHepevt());
   hepevt->clear();
   hepevt->clearCommon();
   return AppResult::OK;
 }
     
+void GenOutputManager::cacheVertices(int nv, const double* xyzt) {
+  if ( _cache ) _cache->setVertices(nv, xyzt);
+}
+
+void GenOutputManager::closeCacheEvent() {
+  if ( !_cache || !_cache->pending() ) return;
+  if ( _cache->writeEvent() ) {
+    ERRLOG(ELerror,"[GEN_CACHE_WRITE]")
+      << "GenOutputManager: can't write event " << _cache->nEvents()+1
+      << " to the event cache" << endmsg;
+  }
+}
+
+void GenOutputManager::writeBanks(AbsEvent* event) {
+
+  // HEPG is made from the common itself, no intermediate Hepevt
+  CdfHepEvt common;
+  HEPG_StorableBank* hepg = common.makeHEPG_Bank(event);
+  CdfHepevt* hepevt  = CdfHepevt::Instance();
+  if ( _cache ) {
+    _cache->addInteraction( *hepevt->HepevtPtr(), *hepevt->Hepev4Ptr() );
+  }
+  if (!hepg || hepg->is_invalid()) {
+    ERRLOG(ELsevere2,"[GEN_BAD_HEPG]")
+      << "GenOutputManager: can't create a valid "
+      << "HEPG_StorableBank"
+      << endmsg;
+    return;
+  }
+  Handle<HEPG_StorableBank> h(hepg);
+  if ((event->append(h)).is_null()) {
+    ERRLOG(ELsevere2,"[GEN_BAD_HEPG]")
+      << "GenOutputManager: can't add"
+      << "HEPG_StorableBank to the event."
+      << endmsg;
+    return;
+  }
+
+  // HEP4 goes through one recycled Hepevt, filled up to NHEP only
+  HepevtPool* pool   = HepevtPool::Instance();
+  Hepevt*     cur    = pool->acquire( *hepevt->HepevtPtr(), 
+				      *hepevt->Hepev4Ptr() );
+  HEP4_StorableBank* hep4 = cur->makeHEP4(event);
+  pool->release(cur);
+  if (!hep4 || hep4->is_invalid()) {
+    ERRLOG(ELsevere2,"[GEN_BAD_HEP4]")
+      << "GenOutputManager: can't create a valid "
+      << "HEP4_StorableBank"
+      << endmsg;
+    return;
+  }
+  Handle<HEP4_StorableBank> h4(hep4);
+  if ((event->append(h4)).is_null()) {
+    ERRLOG(ELsevere2,"[GEN_BAD_HEP4]")
+      << "GenOutputManager: can't add"
+      << "HEP4_StorableBank to the event."
+      << endmsg;
+  }
+}
+    
 AppResult GenOutputManager::abortJob(AbsEvent* event) {
   return AppResult::OK;
 }
@@ -23,9 +23,8 @@
 #include "Edm/ConstHandle.hh"
 
 #include "r_n/CdfRn.hh"
-#include "CLHEP/Random/RandGaussT.h"
-#include "CLHEP/Random/RandFlat.h"
 #include "generatorMods/GenPrimVertModule.hh"
+#include "generatorMods/GenOutputManager.hh"
 #include "SimulationObjects/HEPG_StorableBank.hh"
 #include "SimulationObjects/MVTX_StorableBank.hh"
 
@@ -84,7 +83,10 @@ GenPrimVertModule::GenPrimVertModule( const char* const theName,
     _z0Y("beamZ0Y", this, GenPrimVertModule::_defaultZ0Y, -10000., 10000),
     _useDB("BeamlineFromDB",this,false),
     _useBetaStarWidth("UseBetaStarBeamWidth", this, false),
-    _useBetaStardLdz("UseBetaStarZVertex", this, false)
+    _useBetaStardLdz("UseBetaStarZVertex", this, false),
+    _betaStarZParmFile("BetaStarZParmFile", this, ""),
+    _beamlineCacheFile("BeamlineCacheFile", this, ""),
+    _beamlineDumpFile("BeamlineDumpFile", this, "")
 
 {
 
@@ -124,6 +126,15 @@ GenPrimVertModule::GenPrimVertModule( const char* const theName,
 	      << "\n\t\t NOTE: BetaStarBeamWidth parameters do not affect this function";
   _useBetaStardLdz.addDescription(tmpSstream0.str());
   commands()->append(&_useBetaStardLdz);
+  _betaStarZParmFile.addDescription("\t betaStar z-vertex run range parameter file"
+				    "\n\t\t (default $GENDLDZ_PARM_FILE)");
+  commands()->append(&_betaStarZParmFile);
+  _beamlineCacheFile.addDescription("\t run -> beamline file (makeBeamlineCache) used before the DB;"
+				    "\n\t\t runs not in it go to the DB if BeamlineFromDB is set,"
+				    "\n\t\t otherwise they stop the job");
+  commands()->append(&_beamlineCacheFile);
+  _beamlineDumpFile.addDescription("\t append the DB beamline of every run to this text file");
+  commands()->append(&_beamlineDumpFile);
 
   // Initialize the relevant submenu
   _randomNumberMenu.initialize("RandomNumberMenu",this);
@@ -188,6 +199,10 @@ GenPrimVertModule::GenPrimVertModule( const char* const theName,
   _svxBeam = 0;
   _cotBeam = 0;
   _beamline = 0;
+  _beamlineCache = 0;
+  _beamlineDump = 0;
+  _talkToSigmaX = 0;
+  _talkToSigmaY = 0;
   _zVtxGenerator = 0;
 }
 
@@ -201,20 +216,44 @@ AppResult GenPrimVertModule::beginJob(AbsEvent* aJob) {
   if ( !rn->isReadingFromFile() ) {
     rn->SetEngineSeeds(_randomSeed1.value(), _randomSeed2.value(),"GEN_PRIM_VERT");
   }
+  _talkToSigmaX = _sigmaX.value();
+  _talkToSigmaY = _sigmaY.value();
   //Alignment and beam position
   if(_useDB.value()) {
      _svxBeam = new SvxBeam();
      _cotBeam = new CotBeam();
+     if (!_beamlineDumpFile.value().empty()) {
+       _beamlineDump = fopen(_beamlineDumpFile.value().c_str(), "a");
+       if (_beamlineDump == 0) {
+	 errlog(ELerror,"GenPrimVertModule") 
+	   << " Can't open beamline dump file " << _beamlineDumpFile.value() << endmsg;
+       }
+     }
   } 
+  if (!_beamlineCacheFile.value().empty()) {
+    _beamlineCache = new BeamlineCache();
+    if (_beamlineCache->open(_beamlineCacheFile.value())) {
+      errlog(ELerror,"GenPrimVertModule") 
+	<< " Can't read beamline cache " << _beamlineCacheFile.value() << endmsg;
+      delete _beamlineCache;
+      _beamlineCache = 0;
+      if (!_useDB.value()) return AppResult::ERROR;
+    }
+  }
 
   if (_useBetaStardLdz.value()) {
     _zVtxGenerator = new GendLdz(this->verbose());
+    if (!_betaStarZParmFile.value().empty()) {
+      _zVtxGenerator->setParmFile(_betaStarZParmFile.value());
+    }
     if ( _zVtxGenerator->init() ) {
       // something wrong with betaStar dL/dz class; fall back to Gaussian mode
       errlog(ELwarning,"GenPrimVertModule") 
-	<< " Encountered problems initializing the betaStar z vertex class. Falling back to Gaussian z vertex mode." << endmsg;
+	<< " No betaStar dL/dz parameter file (BetaStarZParmFile or"
+	<< " $GENDLDZ_PARM_FILE). Falling back to Gaussian z vertex mode." << endmsg;
       _useBetaStardLdz.set(false);
-      if (_zVtxGenerator != 0) delete _zVtxGenerator;
+      delete _zVtxGenerator;
+      _zVtxGenerator = 0;
     }
   }
 
@@ -224,16 +263,49 @@ AppResult GenPrimVertModule::beginJob(AbsEvent* aJob) {
 //_____________________________________________________________________________
 AppResult GenPrimVertModule::beginRun( AbsEvent* aRun ) {
 
-  if(_useDB.value()) {
+  bool fromCache = false;
+  if (_beamlineCache) {
+    int runNo = AbsEnv::instance()->runNumber();
+    BeamlineCache::Entry e;
+    if (_beamlineCache->find(runNo,e) == 0) {
+      _pvCentralX.set(e.x);
+      _pvCentralY.set(e.y);
+      _pvCentralZ.set(e.z);
+      _pvSlope_dXdZ.set(e.dxdz);
+      _pvSlope_dYdZ.set(e.dydz);
+      _sigmaZ.set(e.sigmaZ);
+      _sigmaX.set(e.sigmaX > 0. ? e.sigmaX : _talkToSigmaX);
+      _sigmaY.set(e.sigmaY > 0. ? e.sigmaY : _talkToSigmaY);
+      fromCache = true;
+    }
+    else if (_useDB.value()) {
+      errlog(ELwarning,"GenPrimVertModule") << 
+	" No beamline for run " << runNo << " in " 
+	<< _beamlineCacheFile.value() << ", reading the DB" << endmsg;
+    }
+    else {
+					// the previous run's beamline would
+					// be used silently
+      errlog(ELerror,"GenPrimVertModule") << 
+	" No beamline for run " << runNo << " in " 
+	<< _beamlineCacheFile.value() << " and BeamlineFromDB is off" << endmsg;
+      return AppResult::ERROR;
+    }
+  }
+
+  if(_useDB.value() && !fromCache) {
+    int source = 0;
     _svxBeam->loadRun();
     _cotBeam->loadRun();
     //change svt beamline accessor logic from isValid() to isFitted()
     if(_svxBeam->isFitted()) { 
        _beamline = new Beamline(_svxBeam->getBeamline());  
+       source = BeamlineCache::SVX;
     }
     else {
       if(_cotBeam->isValid()) {
         _beamline = new Beamline(_cotBeam->getBeamline());
+        source = BeamlineCache::COT;
 	errlog(ELwarning,"GenPrimVertModule") << 
 	"No Fitted SVX beamline ... using COT beamline for current run " << endmsg;
       }
@@ -248,8 +320,29 @@ AppResult GenPrimVertModule::beginRun( AbsEvent* aRun ) {
       _pvCentralZ.set(_beamline->BeamZ());
       _pvSlope_dXdZ.set(_beamline->SlopeX());
       _pvSlope_dYdZ.set(_beamline->SlopeY());
-      // Don't set x and y from database since they are zero there...
       _sigmaZ.set(_beamline->WidthZ());
+      // x and y widths only where the database has them, mostly they are
+      // zero there and the talk-to values are used
+      _sigmaX.set(_beamline->WidthX() > 0. ? _beamline->WidthX()
+		                            : _talkToSigmaX);
+      _sigmaY.set(_beamline->WidthY() > 0. ? _beamline->WidthY()
+		                            : _talkToSigmaY);
+
+      if (_beamlineDump) {
+	BeamlineCache::Entry e;
+	e.run    = AbsEnv::instance()->runNumber();
+	e.source = source;
+	e.x      = _beamline->BeamX();
+	e.y      = _beamline->BeamY();
+	e.z      = _beamline->BeamZ();
+	e.dxdz   = _beamline->SlopeX();
+	e.dydz   = _beamline->SlopeY();
+	e.sigmaZ = _beamline->WidthZ();
+	e.sigmaX = _beamline->WidthX();
+	e.sigmaY = _beamline->WidthY();
+	BeamlineCache::writeText(_beamlineDump, e);
+	fflush(_beamlineDump);
+      }
     } 
   }
 
@@ -257,9 +350,14 @@ AppResult GenPrimVertModule::beginRun( AbsEvent* aRun ) {
     int runNo = AbsEnv::instance()->runNumber();
 //     if ( _zVtxGenerator->getParms(runNo) ) {
     if ( _zVtxGenerator->getParms(runNo, _cotBeam) ) {
+      // the parameter file is read by the first getParms(): a missing
+      // or bad file shows up here, as does a run past the table
       errlog(ELwarning,"GenPrimVertModule")
 	<< " Encountered problems initializing the betaStar z vertex class for run "
-	<< runNo << ".  Falling back to Gaussian z vertex mode." << endmsg;
+	<< runNo << " (parameter file " 
+	<< ( _betaStarZParmFile.value().empty() ? "$GENDLDZ_PARM_FILE"
+	                                        : _betaStarZParmFile.value() )
+	<< ").  Falling back to Gaussian z vertex mode." << endmsg;
       _useBetaStardLdz.set(false);
     }
   }
@@ -272,7 +370,8 @@ AppResult GenPrimVertModule::beginRun( AbsEvent* aRun ) {
 AppResult GenPrimVertModule::event( AbsEvent* event ) {
 //-----------------------------------------------------------------------------
 // count the primary interactions assuming there are no "holes" in HEPG numbers
-// handle case when an input event already has 1 HEPG and 1 MVTX banks
+// handle case when an input event already has 1 HEPG and 1 MVTX banks, or
+// an MVTX bank with a vertex per HEPG bank (GenCacheInput)
 //-----------------------------------------------------------------------------
   int n_hepg = 0;
   int n_mvtx = 0;
@@ -282,7 +381,8 @@ AppResult GenPrimVertModule::event( AbsEvent* event ) {
   }
 
   for (AbsEvent::ConstIterator it(event,"MVTX_StorableBank"); it.is_valid(); it++) {
-    n_mvtx++;
+    ConstHandle<MVTX_StorableBank> mvtx(it);
+    n_mvtx += mvtx->NVertices();
   }
 					// create MVTX bank of the right length
 					// and fill it
@@ -291,64 +391,49 @@ AppResult GenPrimVertModule::event( AbsEvent* event ) {
   if ( nv > 0 ) {
 
     MVTX_StorableBank* mvtx = new MVTX_StorableBank(event,nv);
-    
-    double*  grn = new double[4*nv];
-    double*  urn = new double[nv];
-    HepRandomEngine* engine = CdfRn::Instance()->GetEngine("GEN_PRIM_VERT");
-    // we don't need to simulate different
-    // bunch-crossings if there is only one 
-    // primary interaction in the event
-    if (nv > 1) {
-      RandFlat::shootArray(engine, nv-1, urn);
+
+    GenVertexSmearer::Beam beam;
+    beam.x0           = _pvCentralX.value();
+    beam.y0           = _pvCentralY.value();
+    beam.z0           = _pvCentralZ.value();
+    beam.dxdz         = _pvSlope_dXdZ.value();
+    beam.dydz         = _pvSlope_dYdZ.value();
+    beam.sigmaX       = _sigmaX.value();
+    beam.sigmaY       = _sigmaY.value();
+    beam.sigmaZ       = _sigmaZ.value();
+    beam.sigmaT       = _sigmaT.value();
+    beam.nBunches     = _nBunches.value();
+    beam.bunchSpacing = _bunchSpacing.value();
+    _smearer.setBeam(beam);
+
+    // Test whether we want to use SigmaX(z), SigmaY(z); the width table
+    // is only rebuilt when these change
+    if (_useBetaStarWidth.value()) {
+      GenVertexSmearer::BetaStarWidth width;
+      width.emittanceX = _emittanceX.value();
+      width.betaStarX  = _betaStarX.value();
+      width.z0X        = _z0X.value();
+      width.emittanceY = _emittanceY.value();
+      width.betaStarY  = _betaStarY.value();
+      width.z0Y        = _z0Y.value();
+      _smearer.setBetaStarWidth(&width);
     }
-    // `grn' numbers are used for P.V. 
-    // smearing in Z, phi and time
-    RandGaussT::shootArray( engine, 4*nv, grn, 0.0, 1.0 );
-    
-    int    bunch;
+    else {
+      _smearer.setBetaStarWidth(0);
+    }
+    // Use the betaStar z vertex model, or approximate z-vertex dist. as Gaussian
+    _smearer.setZGenerator(_useBetaStardLdz.value() ? _zVtxGenerator : 0);
+
+    HepRandomEngine* engine = CdfRn::Instance()->GetEngine("GEN_PRIM_VERT");
+    const double* v = _smearer.generate(engine, nv);
     for (int i=0; i<nv; i++) {
-      if( _useBetaStardLdz.value() ){
-	// Use the betaStar z vertex model
-	mvtx->rw(4*i+3) = _zVtxGenerator->throwZ(engine);
-      }
-      else {
-	// Approximate z-vertex dist. as Gaussian
-	mvtx->rw(4*i+3) = _sigmaZ.value()*grn[4*i+2]+_pvCentralZ.value();
-      }
-      
-      // Test whether we want to use SigmaX(z), SigmaY(z)
-      if (_useBetaStarWidth.value()) {
-	// Calculate the transverse widths
-	_sigmaX.set(sqrt(_emittanceX.value()*(_betaStarX.value()+
-					      pow((mvtx->rw(4*i+3))-_z0X.value(),2)/_betaStarX.value())));
-	_sigmaY.set(sqrt(_emittanceY.value()*(_betaStarY.value()+
-					      pow((mvtx->rw(4*i+3))-_z0Y.value(),2)/_betaStarY.value())));
-      }
-      
-      mvtx->rw(4*i+1) = _sigmaX.value()*grn[4*i  ]+_pvCentralX.value()+
-	_pvSlope_dXdZ.value()*(mvtx->rw(4*i+3));
-      mvtx->rw(4*i+2) = _sigmaY.value()*grn[4*i+1]+_pvCentralY.value()+
-	_pvSlope_dYdZ.value()*(mvtx->rw(4*i+3));
-      
-      // smear vertex production time within the 
-      // bunch-crossing
-      if (i==0) {
-	// by definition primary interaction#1 -
-	// physics event belongs to bunch#0
-	bunch = 0;
-      }
-      else {
-	bunch = int ((2*_nBunches.value()+1)*urn[i-1])-_nBunches.value();
-      }
-      // convert vertex production time into 
-      // seconds
-      
-      mvtx->rw(4*i+4) = (_bunchSpacing.value()*bunch +
-			 _sigmaT.value()*grn[4*i+3]    )*1.e-9;
+      mvtx->rw(4*i+1) = v[4*i  ];
+      mvtx->rw(4*i+2) = v[4*i+1];
+      mvtx->rw(4*i+3) = v[4*i+2];
+      mvtx->rw(4*i+4) = v[4*i+3];
     }
-    
-    delete [] grn;
-    delete [] urn;
+					// for the event cache, if any
+    GenOutputManager::cacheVertices(nv, v);
   }
 
   return AppResult::OK;
@@ -357,6 +442,7 @@ AppResult GenPrimVertModule::event( AbsEvent* event ) {
 //_____________________________________________________________________________
 AppResult GenPrimVertModule::endRun( AbsEvent* aRun ) {
   if(_beamline != 0) delete _beamline;
+  _beamline = 0;
   return AppResult::OK;
 }
 
@@ -365,6 +451,14 @@ AppResult GenPrimVertModule::endJob( AbsEvent* aJob ) {
   if(_cotBeam !=0) delete _cotBeam;
   if(_svxBeam !=0) delete _svxBeam;
   if (_zVtxGenerator != 0) delete _zVtxGenerator;
+  if (_beamlineDump != 0) fclose(_beamlineDump);
+  if (_beamlineCache != 0) {
+    cout << "GenPrimVertModule: " << _beamlineCache->nLookups() 
+	 << " beamline cache lookups, " << _beamlineCache->nLruHits() 
+	 << " LRU hits, " << _beamlineCache->nFileReads() << " record reads"
+	 << endl;
+    delete _beamlineCache;
+  }
   return AppResult::OK;
 }
 
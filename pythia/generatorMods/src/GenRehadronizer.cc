@@ -0,0 +1,36 @@
+//--------------------------------------------------------------------------
+// GenRehadronizer
+//
+// event selection by repeated hadronisation
+//
+//------------------------------------------------------------------------
+#include "generatorMods/GenRehadronizer.hh"
+
+//______________________________________________________________________________
+double GenRehadronizer::select(int nTries, bool weighted)
+{
+  _nHard  = 0;
+  _nExec  = 0;
+  _nFound = 0;
+  if ( nTries < 1 ) nTries = 1;
+  while ( _nFound == 0 ) {
+    newPartonLevel();
+    _nHard++;
+    for ( int itry=0; itry<nTries; itry++ ) {
+      if ( itry > 0 ) restorePartonLevel();
+      _nExec++;
+      if ( !hadronize() ) continue;
+      _nFound++;
+      if ( !weighted ) break;
+      if ( _nFound == 1 ) saveHadronLevel();
+    }
+  }
+  if ( weighted ) {
+    restoreHadronLevel();
+    _weight = double(_nFound)/nTries;
+  }
+  else {
+    _weight = 1.;
+  }
+  return _weight;
+}
@@ -0,0 +1,155 @@
+//--------------------------------------------------------------------------
+// GenTiming
+//
+// phase timing of generator modules
+//
+//------------------------------------------------------------------------
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <math.h>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+
+#include "generatorMods/GenTiming.hh"
+
+//______________________________________________________________________________
+GenTiming::GenTiming()
+{
+  reset();
+}
+
+//______________________________________________________________________________
+void GenTiming::reset()
+{
+  for ( int p=0; p<NPHASES; p++ ) {
+    _t0[p] = _c0[p] = _wall[p] = _cpu[p] = 0.;
+    _calls[p] = 0;
+  }
+  for ( int i=0; i<NCPUBINS; i++ ) _cpuHist[i] = 0;
+  _evWall0 = _evCpu0 = _evWall = _evCpu = 0.;
+  _nEvents = 0;
+  _retryTries.clear();
+  _retryCalls.clear();
+}
+
+//______________________________________________________________________________
+double GenTiming::wallTime()
+{
+					// no clock_gettime: it needs -lrt
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + 1.e-6*tv.tv_usec;
+}
+
+//______________________________________________________________________________
+double GenTiming::cpuTime()
+{
+					// user + system
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_utime.tv_sec + ru.ru_stime.tv_sec +
+    1.e-6*(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec);
+}
+
+//______________________________________________________________________________
+void GenTiming::stopEvent()
+{
+  double cpu = cpuTime() - _evCpu0;
+  _evWall += wallTime() - _evWall0;
+  _evCpu  += cpu;
+  _nEvents++;
+					// bin k holds [2^(k-1), 2^k) us
+  int k = 0;
+  double us = cpu*1.e6;
+  while ( us >= 1. && k < NCPUBINS-1 ) { us *= 0.5; k++; }
+  _cpuHist[k]++;
+}
+
+//______________________________________________________________________________
+void GenTiming::countRetries(const std::string& loop, long ntries)
+{
+  _retryTries[loop] += ntries;
+  _retryCalls[loop] += 1;
+}
+
+//______________________________________________________________________________
+const char* GenTiming::phaseName(int p)
+{
+  static const char* names[NPHASES] = { "callGenerator",
+					"fillHepevt",
+					"hepevtCopy" };
+  return names[p];
+}
+
+//______________________________________________________________________________
+void GenTiming::print(std::ostream& os, const char* who) const
+{
+  long accepted = _calls[HEPEVTCOPY];
+  os << std::endl
+     << " ===== " << who << " timing summary =====" << std::endl
+     << "  events          : " << _nEvents << std::endl
+     << "  wall/cpu time   : " << _evWall << " s / " << _evCpu << " s"
+     << std::endl;
+  if ( _evWall > 0. ) {
+    os << "  events/s        : " << _nEvents/_evWall << std::endl;
+  }
+  if ( accepted > 0 ) {
+    os << "  tries/accepted  : "
+       << double(_calls[CALLGENERATOR])/accepted << std::endl;
+  }
+  for ( int p=0; p<NPHASES; p++ ) {
+    os << "  " << std::setw(14) << std::left << phaseName(p) << std::right
+       << ": " << _calls[p] << " calls, "
+       << _wall[p] << " s wall, " << _cpu[p] << " s cpu";
+    if ( _evWall > 0. ) os << " (" << 100.*_wall[p]/_evWall << "%)";
+    os << std::endl;
+  }
+  for ( std::map<std::string, long>::const_iterator i = _retryTries.begin();
+	i != _retryTries.end(); ++i ) {
+    long ncalls = _retryCalls.find(i->first)->second;
+    os << "  " << std::setw(14) << std::left << i->first << std::right
+       << ": " << i->second << " tries in " << ncalls << " calls, "
+       << double(i->second)/ncalls << " tries/call" << std::endl;
+  }
+  os << "  cpu time per event [us]:" << std::endl;
+  for ( int k=0; k<NCPUBINS; k++ ) {
+    if ( !_cpuHist[k] ) continue;
+    double lo = ( k == 0 ) ? 0. : ldexp(1.,k-1);
+    os << "    " << std::setw(12) << lo << " - " << std::setw(12)
+       << ldexp(1.,k) << " : " << _cpuHist[k] << std::endl;
+  }
+}
+
+//______________________________________________________________________________
+int GenTiming::writeSummary(const std::string& fileName, const char* who) const
+{
+  std::ofstream out(fileName.c_str());
+  if ( !out ) return -1;
+
+  out << "module " << who << std::endl
+      << "events " << _nEvents << std::endl
+      << "wall_s " << _evWall << std::endl
+      << "cpu_s "  << _evCpu  << std::endl
+      << "events_per_s " << ( _evWall > 0. ? _nEvents/_evWall : 0. )
+      << std::endl
+      << "tries_per_accepted "
+      << ( _calls[HEPEVTCOPY] ? double(_calls[CALLGENERATOR])/_calls[HEPEVTCOPY]
+	   : 0. ) << std::endl;
+  for ( int p=0; p<NPHASES; p++ ) {
+    out << "phase " << phaseName(p) << " " << _calls[p] << " "
+	<< _wall[p] << " " << _cpu[p] << std::endl;
+  }
+  for ( std::map<std::string, long>::const_iterator i = _retryTries.begin();
+	i != _retryTries.end(); ++i ) {
+    out << "retry " << i->first << " " << i->second << " "
+	<< _retryCalls.find(i->first)->second << std::endl;
+  }
+  for ( int k=0; k<NCPUBINS; k++ ) {
+    if ( _cpuHist[k] ) {
+      out << "cpu_us_bin " << ( k == 0 ? 0. : ldexp(1.,k-1) ) << " "
+	  << ldexp(1.,k) << " " << _cpuHist[k] << std::endl;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,28 @@
+//--------------------------------------------------------------------------
+// GenValueBatch
+//
+// array draws of the FakeEv / MixFakeEv generation parameters
+//
+//------------------------------------------------------------------------
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "CLHEP/Random/RandGaussT.h"
+#include "generatorMods/GenValueBatch.hh"
+
+//______________________________________________________________________________
+bool GenValueBatch::shootArray(HepRandomEngine* engine, Shape shape, int n,
+			       double* out, double mean, double sigma,
+			       double min, double max)
+{
+  if ( shape == GAUSSIAN && sigma && !min && !max ) {
+    RandGaussT::shootArray(engine,n,out,mean,sigma);
+  }
+  else if ( shape == FLAT ) {
+    RandFlat::shootArray(engine,n,out,min,max);
+  }
+  else {
+    return false;
+  }
+  for ( int i=0; i<n; i++ ) out[i] = (float) out[i];
+  return true;
+}
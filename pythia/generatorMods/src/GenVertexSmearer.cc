@@ -0,0 +1,125 @@
+//--------------------------------------------------------------------------
+// GenVertexSmearer
+//
+// batched primary vertex smearing
+//
+//------------------------------------------------------------------------
+#include <math.h>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandGaussT.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/GendLdz.hh"
+#include "generatorMods/GenVertexSmearer.hh"
+
+const double GenVertexSmearer::ZGRIDMIN  = -200.;
+const double GenVertexSmearer::ZGRIDMAX  =  200.;
+const double GenVertexSmearer::ZGRIDSTEP =  0.25;
+
+//______________________________________________________________________________
+GenVertexSmearer::GenVertexSmearer()
+  : _useWidth(false),
+    _zGen(0)
+{
+  Beam b = { 0., 0., 0., 0., 0., 0., 0., 0., 0., 0, 0. };
+  _beam = b;
+  BetaStarWidth w = { 0., 0., 0., 0., 0., 0. };
+  _width = w;
+}
+
+//______________________________________________________________________________
+double GenVertexSmearer::exactWidth(double emittance, double betaStar, 
+				    double z0, double z)
+{
+  return sqrt(emittance*(betaStar + (z-z0)*(z-z0)/betaStar));
+}
+
+//______________________________________________________________________________
+void GenVertexSmearer::setBetaStarWidth(const BetaStarWidth* width)
+{
+  if ( width == 0 ) {
+    _useWidth = false;
+    return;
+  }
+  if ( _useWidth && !_sx.empty() &&
+       width->emittanceX == _width.emittanceX &&
+       width->betaStarX  == _width.betaStarX  && width->z0X == _width.z0X &&
+       width->emittanceY == _width.emittanceY &&
+       width->betaStarY  == _width.betaStarY  && width->z0Y == _width.z0Y ) {
+    return;
+  }
+  _useWidth = true;
+  _width    = *width;
+  int n = int((ZGRIDMAX-ZGRIDMIN)/ZGRIDSTEP + 0.5) + 1;
+  _sx.resize(n);
+  _sy.resize(n);
+  for ( int i=0; i<n; i++ ) {
+    double z = ZGRIDMIN + i*ZGRIDSTEP;
+    _sx[i] = exactWidth(_width.emittanceX, _width.betaStarX, _width.z0X, z);
+    _sy[i] = exactWidth(_width.emittanceY, _width.betaStarY, _width.z0Y, z);
+  }
+}
+
+//______________________________________________________________________________
+void GenVertexSmearer::widths(double z, double& sx, double& sy) const
+{
+  if ( !_useWidth ) {
+    sx = _beam.sigmaX;
+    sy = _beam.sigmaY;
+    return;
+  }
+  double x = (z - ZGRIDMIN)/ZGRIDSTEP;
+  int    i = int(x);
+  if ( x < 0. || i >= int(_sx.size())-1 ) {
+					// outside the grid: rare, exact
+    sx = exactWidth(_width.emittanceX, _width.betaStarX, _width.z0X, z);
+    sy = exactWidth(_width.emittanceY, _width.betaStarY, _width.z0Y, z);
+    return;
+  }
+  double f = x - i;
+  sx = _sx[i] + f*(_sx[i+1]-_sx[i]);
+  sy = _sy[i] + f*(_sy[i+1]-_sy[i]);
+}
+
+//______________________________________________________________________________
+const double* GenVertexSmearer::generate(HepRandomEngine* engine, int nv)
+{
+  if ( int(_grn.size()) < 4*nv ) {
+    _grn.resize(4*nv);
+    _urn.resize(nv);
+    _z  .resize(nv);
+    _out.resize(4*nv);
+  }
+  double* grn = &_grn[0];
+  double* out = &_out[0];
+					// we don't need to simulate different
+					// bunch-crossings if there is only one
+					// primary interaction in the event
+  if ( nv > 1 ) RandFlat::shootArray(engine, nv-1, &_urn[0]);
+					// `grn' numbers are used for P.V.
+					// smearing in x, y, z and time
+  RandGaussT::shootArray(engine, 4*nv, grn, 0.0, 1.0);
+
+  if ( _zGen ) {
+    _zGen->throwZ(engine, nv, &_z[0]);
+  }
+  else {
+    for ( int i=0; i<nv; i++ ) _z[i] = _beam.sigmaZ*grn[4*i+2] + _beam.z0;
+  }
+
+  for ( int i=0; i<nv; i++ ) {
+    double z = _z[i];
+    double sx, sy;
+    widths(z, sx, sy);
+    out[4*i  ] = sx*grn[4*i  ] + _beam.x0 + _beam.dxdz*z;
+    out[4*i+1] = sy*grn[4*i+1] + _beam.y0 + _beam.dydz*z;
+    out[4*i+2] = z;
+					// primary interaction #1, the physics
+					// event, belongs to bunch #0
+    int bunch = ( i == 0 ) ? 0 :
+      int((2*_beam.nBunches+1)*_urn[i-1]) - _beam.nBunches;
+					// production time in seconds
+    out[4*i+3] = (_beam.bunchSpacing*bunch + _beam.sigmaT*grn[4*i+3])*1.e-9;
+  }
+  return out;
+}
@@ -26,6 +26,7 @@
 #include "generatorMods/UnwtModule.hh"
 //#include "generatorMods/GrappaModule.hh"
 #include "generatorMods/LesHouchesModule.hh"
+#include "generatorMods/GenCacheInputModule.hh"
 
 const char* HardScatGenSequence::name = "HardScatGenSequence";
 
@@ -117,6 +118,12 @@ HardScatGenSequence::HardScatGenSequence()
   theFramework->add( aMod );
   aMod->setEnabled(false);
 
+// Replay of events cached by GenOutputManager
+  aMod = new GenCacheInputModule();
+  append( aMod );
+  theFramework->add( aMod );
+  aMod->setEnabled(false);
+
 
 }
 
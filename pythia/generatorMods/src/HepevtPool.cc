@@ -0,0 +1,126 @@
+//--------------------------------------------------------------------------
+// HepevtPool
+//
+// Hepevt recycling for AbsGenModule/GenOutputManager
+//
+//------------------------------------------------------------------------
+#include <string.h>
+#include <iostream>
+
+#include "stdhep_i/Hepevt.hh"
+#include "generatorMods/HepevtPool.hh"
+
+HepevtPool* HepevtPool::_instance = 0;
+
+//______________________________________________________________________________
+HepevtPool* HepevtPool::Instance()
+{
+  if ( !_instance ) _instance = new HepevtPool();
+  return _instance;
+}
+
+//______________________________________________________________________________
+HepevtPool::HepevtPool()
+  : _nAllocated(0),
+    _nAcquired(0),
+    _nRecycled(0),
+    _bytesCopied(0.)
+{ }
+
+//______________________________________________________________________________
+HepevtPool::~HepevtPool()
+{
+  purge();
+}
+
+//______________________________________________________________________________
+void HepevtPool::purge()
+{
+  for ( std::vector<Hepevt*>::iterator i = _free.begin();
+	i != _free.end(); ++i ) {
+    delete *i;
+  }
+  _free.clear();
+}
+
+//______________________________________________________________________________
+Hepevt* HepevtPool::acquire(HEPEVT& hepevt, HEPEV4& hepev4)
+{
+  Hepevt* cur;
+  _nAcquired++;
+  if ( _free.empty() ) {
+					// pool is dry: the full-size copy is
+					// paid once per slot and per job
+    cur = new Hepevt( hepevt, hepev4 );
+    _nAllocated++;
+    _bytesCopied += sizeof(HEPEVT) + sizeof(HEPEV4);
+  }
+  else {
+    cur = _free.back();
+    _free.pop_back();
+    _nRecycled++;
+    _bytesCopied += copyRows(*cur->HepevtPtr(), *cur->Hepev4Ptr(),
+			     hepevt, hepev4);
+  }
+  return cur;
+}
+
+//______________________________________________________________________________
+void HepevtPool::reclaim(std::list<Hepevt*>& content)
+{
+  for ( std::list<Hepevt*>::iterator i = content.begin();
+	i != content.end(); ++i ) {
+    if ( *i ) _free.push_back( *i );
+  }
+  content.clear();
+}
+
+//______________________________________________________________________________
+size_t HepevtPool::copyRows(HEPEVT& to, HEPEV4& to4,
+			    const HEPEVT& from, const HEPEV4& from4)
+{
+  // rows past NHEP are never read by makeHEPG/makeHEP4, so only
+  // the filled part of the per-particle arrays is copied
+  const int nmax = sizeof(from.ISTHEP)/sizeof(from.ISTHEP[0]);
+  int n = from.NHEP;
+  if ( n < 0    ) n = 0;
+  if ( n > nmax ) n = nmax;
+
+  size_t bytes = 0;
+					// /HEPEVT/
+  to.NEVHEP = from.NEVHEP;
+  to.NHEP   = n;
+  memcpy(to.ISTHEP, from.ISTHEP, n*sizeof(from.ISTHEP[0]));
+  memcpy(to.IDHEP , from.IDHEP , n*sizeof(from.IDHEP [0]));
+  memcpy(to.JMOHEP, from.JMOHEP, n*sizeof(from.JMOHEP[0]));
+  memcpy(to.JDAHEP, from.JDAHEP, n*sizeof(from.JDAHEP[0]));
+  memcpy(to.PHEP  , from.PHEP  , n*sizeof(from.PHEP  [0]));
+  memcpy(to.VHEP  , from.VHEP  , n*sizeof(from.VHEP  [0]));
+  bytes += sizeof(from.NEVHEP) + sizeof(from.NHEP)
+    + n*( sizeof(from.ISTHEP[0]) + sizeof(from.IDHEP[0])
+	  + sizeof(from.JMOHEP[0]) + sizeof(from.JDAHEP[0])
+	  + sizeof(from.PHEP  [0]) + sizeof(from.VHEP  [0]) );
+					// /HEPEV4/
+  to4.EVENTWEIGHTLH = from4.EVENTWEIGHTLH;
+  to4.ALPHAQEDLH    = from4.ALPHAQEDLH;
+  to4.ALPHAQCDLH    = from4.ALPHAQCDLH;
+  to4.IDRUPLH       = from4.IDRUPLH;
+  memcpy(to4.SCALELH     , from4.SCALELH     , sizeof(from4.SCALELH));
+  memcpy(to4.SPINLH      , from4.SPINLH      , n*sizeof(from4.SPINLH[0]));
+  memcpy(to4.ICOLORFLOWLH, from4.ICOLORFLOWLH, n*sizeof(from4.ICOLORFLOWLH[0]));
+  bytes += sizeof(from4.EVENTWEIGHTLH) + sizeof(from4.ALPHAQEDLH)
+    + sizeof(from4.ALPHAQCDLH) + sizeof(from4.IDRUPLH)
+    + sizeof(from4.SCALELH)
+    + n*( sizeof(from4.SPINLH[0]) + sizeof(from4.ICOLORFLOWLH[0]) );
+
+  return bytes;
+}
+
+//______________________________________________________________________________
+void HepevtPool::print(std::ostream& os) const
+{
+  os << " HepevtPool: " << _nAcquired << " Hepevt requested, "
+     << _nAllocated << " allocated, " << _nRecycled << " recycled, "
+     << _free.size() << " pooled, "
+     << _bytesCopied << " bytes copied" << std::endl;
+}
@@ -29,6 +29,7 @@
 //     Feb 2004  jlys, for Herwig v 6504
 //     Feb 2005  jdlee, add talk-to for SOFTME
 //     cjl h 6505+jimmy  add call jminit hwmsct jmefin
+//     parton level veto (PartonAcceptanceMenu) before hadronisation
 //------------------------------------------------------------------------
 //-----------------------
 // This Class's Header --
@@ -53,6 +54,7 @@
 //#include "ParticleDB/hepevt.hh"
 #include "stdhep_i/CdfHepevt.hh"
 #include "stdhep_i/Hepevt.hh"
+#include "ErrorLogger_i/gERRLOG.hh"
 
 //void InitHerwigCommonBlocks();
 
@@ -292,7 +294,10 @@ HerwigModule::HerwigModule() :
   _ptjim_Parm("Ptjim",this,2.5),
   _msflag_Parm("Msflag",this,1),
   _jmrad73_Parm("Jmrad73",this,0.71),
-  _jmrad91_Parm("Jmrad91",this,0.71)
+  _jmrad91_Parm("Jmrad91",this,0.71),
+  _partonAcceptance(this,"PartonAcceptanceMenu",
+		    "Parton level acceptance before hadronisation"),
+  _partonVetoes(0)
 
 {
   // herwig menu's and commands
@@ -345,6 +350,15 @@ AppResult HerwigModule::genBeginJob( ) {
   hweini_();
 
   jminit_();
+                                // the parton level veto runs on the
+                                // shower, there is nothing to cut on
+                                // without it
+  if(_partonAcceptance.enabled() && _noshower_Parm.value()) {
+    ERRLOG(ELerror,"[HERWIG_PARTON_VETO]")
+      << name() << ": PartonAcceptanceMenu enable set with No_shower,"
+      << " the parton level veto needs the shower" << endmsg;
+    return AppResult::ERROR;
+  }
 
   //preset event counter
   _events = 0;
@@ -362,6 +376,14 @@ AppResult HerwigModule::genEndJob() {
   hwefin_();
                                // For Jimmy
   jmefin_();
+                               // parton level veto: the accepted cross
+                               // section is the HERWIG one times the
+                               // efficiency printed here
+  if (_partonAcceptance.enabled()) {
+    _partonAcceptance.print(std::cout,name());
+    std::cout << " " << name() << ": " << _partonVetoes
+	      << " events vetoed before hadronisation" << std::endl;
+  }
                                // User terminal calculations if wanted
   hwaend_();
   return AppResult::OK;
@@ -392,7 +414,11 @@ int HerwigModule::callGenerator(AbsEvent* event) {
     std::cout << " Herwig not properly initialized" << std::endl;
   }
 
+  int ntries = 0;
+  int nvetoed = 0;
   while(!goodev){    
+    ++ntries;
+    bool vetoed = false;
     hepevt->HepevtPtr()->NEVHEP = _events;
     hwuine_();  // Initialize event
     hwepro_();  // Generate Hard Process
@@ -407,8 +433,13 @@ int HerwigModule::callGenerator(AbsEvent* event) {
       }
       //  v6.1      hwdhqk_();  // Do heavy quark decays 
       hwdhob_();  // Do heavy quark decays 
-      hwanal0_(&ihwcod0);
-      if(ihwcod0 == 1 && iabort == 0){
+      // parton level veto on the showered event, Jimmy's secondary
+      // scatters included, before cluster formation
+      if(_partonAcceptance.enabled() && iabort == 0) {
+        vetoed = partonVeto(nvetoed);
+      }
+      if(!vetoed) hwanal0_(&ihwcod0);
+      if(ihwcod0 == 1 && iabort == 0 && !vetoed){
         if(! _nohadroniz_Parm.value()) {
 	  hwcfor_();  // Do cluster formation
           hwcdec_();  // Do cluster decays
@@ -419,6 +450,10 @@ int HerwigModule::callGenerator(AbsEvent* event) {
       }
     }
     hwufne_();  // Finish event
+    if(vetoed) {
+      ++nvetoed;
+      continue;
+    }
                                       // User event analysis if wanted
     int ihwcod = 1;
     hwanal_(&ihwcod);
@@ -435,35 +470,43 @@ int HerwigModule::callGenerator(AbsEvent* event) {
       }
     }
   }
+  countRetries("errorRetry", ntries);
+  if(_partonAcceptance.enabled()) countRetries("partonVeto", nvetoed);
   _events++;
   return 0;
 }
 
 //______________________________________________________________________________
-void HerwigModule::fillHepevt() {
-  // Put output into STDHEP version of HEPEVT common
+bool HerwigModule::partonVeto(int nvetoed) {
+  // apply the parton level acceptance to the showered event, true if
+  // the event has to be dropped before cluster formation
 
   int mconv = 1;
   hwghep_(&mconv);
+  GenAcceptanceMenu::Decision d = 
+    _partonAcceptance.decide(*CdfHepevt::Instance()->HepevtPtr(),nvetoed);
+  if(d == GenAcceptanceMenu::FORCED) {
+    ERRLOG(ELerror,"[HERWIG_PARTON_VETO]")
+      << name() << ": no event passed the parton level acceptance in "
+      << nvetoed+1 << " tries, hadronising the last one" << endmsg;
+  }
+  if(d != GenAcceptanceMenu::REJECTED) return false;
+  ++_partonVetoes;
+  return true;
+}
 
-  Herwig* herwig = Herwig::Instance();
-  CdfHepevt::Instance()->Hepev4Ptr()->EVENTWEIGHTLH =  herwig->Hwevnt()->evwgt;
-  int i = 0;
-  while ( (CdfHepevt::Instance()->HepevtPtr()->ISTHEP[i] != 123)  &&  (i < CdfHepevt::Instance()->HepevtPtr()->NHEP))
-    {
-      i++;
-    }
-
-  float px = CdfHepevt::Instance()->HepevtPtr()->PHEP[i][0]; 
-  float py = CdfHepevt::Instance()->HepevtPtr()->PHEP[i][1]; 
+//______________________________________________________________________________
+void HerwigModule::fillHepevt() {
+  // Put output into STDHEP version of HEPEVT common
 
-  float pthat = px*px+py*py;
-  if ( pthat > 0.0 )
-    pthat=std::sqrt(px*px+py*py);
-  else
-    pthat = 0.;
-  
-  CdfHepevt::Instance()->Hepev4Ptr()->SCALELH[5]  = pthat;
+  int mconv = 1;
+  hwghep_(&mconv);
+				// event weight and pt of the first
+				// outgoing hard parton (ISTHEP=123)
+  CdfHepevt* hepevt = CdfHepevt::Instance();
+  _herwigRecord.index(*hepevt->HepevtPtr());
+  _herwigRecord.fillHepev4(*hepevt->HepevtPtr(),*hepevt->Hepev4Ptr(),
+			   Herwig::Instance()->Hwevnt()->evwgt);
  }
 
 //______________________________________________________________________________
@@ -1560,6 +1603,7 @@ void HerwigModule::InitializeTalkTo() {
     commands( )->append( &_15Menu);                 
     commands( )->append( &_16Menu);                 
     commands( )->append( &_17Menu);                 
+    commands( )->append( &_partonAcceptance);
  
     //   commands( )->append( &_decayTable_Parm);
     //   commands( )->append( &_scaleChoiceParm);
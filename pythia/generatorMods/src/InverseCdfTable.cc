@@ -0,0 +1,46 @@
+//--------------------------------------------------------------------------
+// InverseCdfTable
+//
+// tabulated inverse CDF with binary search
+//
+//------------------------------------------------------------------------
+#include <algorithm>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/InverseCdfTable.hh"
+
+//______________________________________________________________________________
+void InverseCdfTable::init(const std::vector<double>& x, 
+			   const std::vector<double>& w)
+{
+  int n = w.size();
+  _x = x;
+  _f.resize(n+1);
+  _f[0] = 0.;
+  for ( int i=0; i<n; i++ ) _f[i+1] = _f[i] + w[i];
+					// normalize the integral
+  double fsum = _f[n];
+  for ( int i=0; i<n; i++ ) _f[i+1] = _f[i+1]/fsum;
+}
+
+//______________________________________________________________________________
+double InverseCdfTable::invert(double u) const
+{
+					// first cell i with u <= f[i+1]
+  int i = std::lower_bound(_f.begin()+1, _f.end(), u) - (_f.begin()+1);
+  if ( i >= cells() ) return _x.back();
+					// interpolate linearly for better
+					// accuracy
+  return _x[i]+(u-_f[i])*((_x[i+1]-_x[i])/(_f[i+1]-_f[i]));
+}
+
+//______________________________________________________________________________
+double InverseCdfTable::shoot(HepRandomEngine* engine) const
+{
+  double rn;
+  do {
+    rn = RandFlat::shoot(engine);
+  } while ( rn <= 0. || rn > 1. );
+  return invert(rn);
+}
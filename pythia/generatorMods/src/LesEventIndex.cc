@@ -0,0 +1,198 @@
+//--------------------------------------------------------------------------
+// LesEventIndex
+//
+// byte offsets of the <event> blocks of a Les Houches event file
+//
+//------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <sstream>
+
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/LesEventIndex.hh"
+
+static const char magic[] = "LESIDX01";
+
+//______________________________________________________________________________
+bool LesEventIndex::isTag(const char* line, const char* tag)
+{
+  while ( *line == ' ' || *line == '\t' ) ++line;
+  size_t n = strlen(tag);
+  if ( strncmp(line,tag,n) ) return false;
+  char c = line[n];
+  return c == '>' || c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+    c == '\0';
+}
+
+//______________________________________________________________________________
+int LesEventIndex::stat(const std::string& fileName,
+			off_t& size, time_t& mtime) const
+{
+  struct stat st;
+  if ( ::stat(fileName.c_str(),&st) ) return -1;
+  size  = st.st_size;
+  mtime = st.st_mtime;
+  return 0;
+}
+
+//______________________________________________________________________________
+int LesEventIndex::build(const std::string& fileName, long last)
+{
+  _offsets.clear();
+  FILE* in = fopen(fileName.c_str(),"r");
+  if ( !in || stat(fileName,_fileSize,_mtime) ) {
+    ERRLOG(ELerror,"[LES_EVENT_INDEX]")
+      << "LesEventIndex: can't open " << fileName << endmsg;
+    if ( in ) fclose(in);
+    return -1;
+  }
+  _footer   = -1;
+  _complete = true;
+  off_t pos = 0;
+  char* line = 0;
+  size_t cap = 0;
+  ssize_t len;
+  while ( (len = getline(&line,&cap,in)) > 0 ) {
+    if ( line[0] == '<' || line[0] == ' ' || line[0] == '\t' ) {
+      if ( isTag(line,"<event") ) {
+	_offsets.push_back(pos);
+	if ( last >= 0 && long(_offsets.size()) > last ) {
+	  _complete = false;
+	  break;
+	}
+      }
+      else if ( isTag(line,"</LesHouchesEvents") ) {
+	_footer = pos;
+	break;
+      }
+    }
+    pos += len;
+  }
+  free(line);
+  fclose(in);
+
+  if ( _footer < 0 && _complete ) _footer = _fileSize;
+  _headerEnd = _offsets.empty() ? _footer : _offsets[0];
+  return 0;
+}
+
+//______________________________________________________________________________
+int LesEventIndex::read(const std::string& indexName,
+			const std::string& fileName)
+{
+  _offsets.clear();
+  _complete = false;
+  off_t  size;
+  time_t mtime;
+  if ( stat(fileName,size,mtime) ) return -1;
+  FILE* in = fopen(indexName.c_str(),"rb");
+  if ( !in ) return -1;
+
+  char m[8];
+  long long h[5];
+  int rc = -1;
+  if ( fread(m,1,8,in) == 8 && strncmp(m,magic,8) == 0 &&
+       fread(h,sizeof(long long),5,in) == 5 &&
+       h[0] == size && h[1] == mtime && h[4] >= 0 ) {
+					// not stale: take the offsets
+    std::vector<long long> o(h[4]);
+    if ( o.empty() || 
+	 fread(&o[0],sizeof(long long),o.size(),in) == o.size() ) {
+      _fileSize  = size;
+      _mtime     = mtime;
+      _headerEnd = h[2];
+      _footer    = h[3];
+      _complete  = true;
+      _offsets.assign(o.begin(),o.end());
+      rc = 0;
+    }
+  }
+  fclose(in);
+  return rc;
+}
+
+//______________________________________________________________________________
+int LesEventIndex::write(const std::string& indexName) const
+{
+  if ( !_complete ) return -1;
+					// many jobs may load() the same file
+					// at once: rename a private copy
+  std::ostringstream tmp;
+  tmp << indexName << ".tmp" << getpid();
+  FILE* out = fopen(tmp.str().c_str(),"wb");
+  if ( !out ) return -1;
+  long long h[5] = { _fileSize, _mtime, _headerEnd, _footer, nEvents() };
+  std::vector<long long> o(_offsets.begin(),_offsets.end());
+  bool ok =
+    fwrite(magic,1,8,out) == 8 &&
+    fwrite(h,sizeof(long long),5,out) == 5 &&
+    ( o.empty() || 
+      fwrite(&o[0],sizeof(long long),o.size(),out) == o.size() );
+  if ( fclose(out) ) ok = false;
+  if ( ok && rename(tmp.str().c_str(),indexName.c_str()) ) ok = false;
+  if ( !ok ) remove(tmp.str().c_str());
+  return ok ? 0 : -1;
+}
+
+//______________________________________________________________________________
+int LesEventIndex::load(const std::string& fileName, std::string indexName,
+			long last)
+{
+  if ( indexName.empty() ) indexName = LesEventIndex::indexName(fileName);
+  if ( read(indexName,fileName) == 0 ) return 0;
+  if ( build(fileName,last) ) return -1;
+  if ( _complete && write(indexName) ) {
+    ERRLOG(ELwarning,"[LES_EVENT_INDEX]")
+      << "LesEventIndex: can't write " << indexName
+      << ", the index is rebuilt by every job" << endmsg;
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int LesEventIndex::writeSlice(const std::string& fileName,
+			      const std::string& sliceName,
+			      long first, long n) const
+{
+  if ( first < 0 || first >= nEvents() ) return -1;
+  long last = ( n > 0 && first+n < nEvents() ) ? first+n : nEvents();
+					// a partial index must reach past
+					// the last event copied
+  if ( !_complete && last >= nEvents() ) return -1;
+  off_t end = ( last < nEvents() ) ? _offsets[last] : _footer;
+
+  FILE* in  = fopen(fileName.c_str(),"rb");
+  FILE* out = fopen(sliceName.c_str(),"wb");
+  bool ok = in && out;
+					// [0,header) [first,end) [footer,EOF)
+  off_t range[3][2] = { { 0,               _headerEnd },
+			{ _offsets[first], end        },
+			{ _footer,         _fileSize  } };
+  std::vector<char> buf(1<<20);
+  for ( int r=0; ok && r<(_complete ? 3 : 2); r++ ) {
+    if ( fseeko(in,range[r][0],SEEK_SET) ) ok = false;
+    for ( off_t left = range[r][1]-range[r][0]; ok && left > 0; ) {
+      size_t k = left < off_t(buf.size()) ? left : buf.size();
+      if ( fread (&buf[0],1,k,in ) != k ||
+	   fwrite(&buf[0],1,k,out) != k ) ok = false;
+      left -= k;
+    }
+  }
+  if ( ok && !_complete && fputs("</LesHouchesEvents>\n",out) < 0 ) {
+    ok = false;
+  }
+  if ( in ) fclose(in);
+  if ( out && fclose(out) ) ok = false;
+  if ( !ok ) {
+    ERRLOG(ELerror,"[LES_EVENT_INDEX]")
+      << "LesEventIndex: can't copy events of " << fileName
+      << " to " << sliceName << endmsg;
+    remove(sliceName.c_str());
+    return -1;
+  }
+  return 0;
+}
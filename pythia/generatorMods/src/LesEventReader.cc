@@ -0,0 +1,387 @@
+//--------------------------------------------------------------------------
+// LesEventReader
+//
+// plain/gzip Les Houches event file reader with a prefetching thread,
+// and the UPINIT/UPEVNT hooks serving PYTHIA and HERWIG from it
+//
+//------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include <sstream>
+
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/LesEventReader.hh"
+#include "generatorMods/LesEventIndex.hh"
+
+LesEventReader* LesEventReader::_active = 0;
+bool            LesEventReader::_hooked = false;
+
+					// numbers, Fortran D exponents allowed
+static void fortranExponents(char* p)
+{
+  for ( ; *p; ++p ) if ( *p == 'D' || *p == 'd' ) *p = 'E';
+}
+
+static bool number(char*& p, double& x)
+{
+  char* e;
+  x = strtod(p,&e);
+  if ( e == p ) return false;
+  p = e;
+  return true;
+}
+
+static bool number(char*& p, int& i)
+{
+  char* e;
+  i = strtol(p,&e,10);
+  if ( e == p ) return false;
+  p = e;
+  return true;
+}
+
+//______________________________________________________________________________
+LesEventReader::LesEventReader()
+  : _file(0),
+    _line(1<<16),
+    _skip(0),
+    _in(0), _out(0), _nFull(0),
+    _eof(false), _stop(false), _running(false),
+    _nRead(0),
+    _nWaits(0),
+    _reported(false)
+{
+  pthread_mutex_init(&_mutex,0);
+  pthread_cond_init (&_notEmpty,0);
+  pthread_cond_init (&_notFull,0);
+}
+
+//______________________________________________________________________________
+LesEventReader::~LesEventReader()
+{
+  close();
+  pthread_cond_destroy (&_notFull);
+  pthread_cond_destroy (&_notEmpty);
+  pthread_mutex_destroy(&_mutex);
+}
+
+//______________________________________________________________________________
+bool LesEventReader::gzipped(const std::string& fileName)
+{
+  FILE* f = fopen(fileName.c_str(),"rb");
+  if ( !f ) return false;
+  unsigned char m[2] = { 0, 0 };
+  size_t n = fread(m,1,2,f);
+  fclose(f);
+  return n == 2 && m[0] == 0x1f && m[1] == 0x8b;
+}
+
+//______________________________________________________________________________
+int LesEventReader::open(const std::string& fileName, int queueSize,
+			 long skip, off_t offset)
+{
+  close();
+  _fileName = fileName;
+  gzFile f = gzopen(fileName.c_str(),"rb");
+  if ( !f ) {
+    ERRLOG(ELerror,"[LES_READER]")
+      << "LesEventReader: can't open " << fileName << endmsg;
+    return -1;
+  }
+#if ZLIB_VERNUM >= 0x1240
+  gzbuffer(f,1<<20);
+#endif
+  _file = f;
+  if ( readInit() ) {
+    ERRLOG(ELerror,"[LES_READER]")
+      << "LesEventReader: no valid <init> block in " << fileName << endmsg;
+    close();
+    return -1;
+  }
+					// gzseek64 past 2 GB on 32 bit builds
+#if defined(_LARGEFILE64_SOURCE) && ZLIB_VERNUM >= 0x1240
+  if ( offset > 0 && gzseek64(f,offset,SEEK_SET) != offset ) {
+#else
+  if ( offset > 0 && gzseek(f,offset,SEEK_SET) != offset ) {
+#endif
+    ERRLOG(ELerror,"[LES_READER]")
+      << "LesEventReader: can't seek to byte " << offset << " of "
+      << fileName << endmsg;
+    close();
+    return -1;
+  }
+
+  _skip    = skip;
+  _ring.resize(queueSize > 0 ? queueSize : 1);
+  _in = _out = _nFull = 0;
+  _eof = _stop = _reported = false;
+  _nRead = _nWaits = 0;
+  _error.clear();
+  if ( pthread_create(&_thread,0,&LesEventReader::run,this) ) {
+    ERRLOG(ELerror,"[LES_READER]")
+      << "LesEventReader: can't start the reading thread" << endmsg;
+    close();
+    return -1;
+  }
+  _running = true;
+  return 0;
+}
+
+//______________________________________________________________________________
+void LesEventReader::close()
+{
+  if ( _running ) {
+    pthread_mutex_lock(&_mutex);
+    _stop = true;
+    pthread_cond_broadcast(&_notFull);
+    pthread_mutex_unlock(&_mutex);
+    pthread_join(_thread,0);
+    _running = false;
+  }
+  if ( _file ) gzclose((gzFile) _file);
+  _file = 0;
+  if ( _active == this ) _active = 0;
+}
+
+//______________________________________________________________________________
+bool LesEventReader::getline()
+{
+  // whole line into _line, however long
+  gzFile f = (gzFile) _file;
+  size_t n = 0;
+  _line[0] = '\0';
+  while ( gzgets(f,&_line[n],_line.size()-n) ) {
+    n += strlen(&_line[n]);
+    if ( n > 0 && _line[n-1] == '\n' ) return true;
+    if ( n+1 < _line.size() ) return true;          // last line, no '\n'
+    _line.resize(2*_line.size());
+  }
+  return n > 0;
+}
+
+//______________________________________________________________________________
+int LesEventReader::findTag(const char* tag)
+{
+  // 1 at the line starting with tag, 0 at the end of the events
+  while ( getline() ) {
+    if ( LesEventIndex::isTag(&_line[0],tag) ) return 1;
+    if ( LesEventIndex::isTag(&_line[0],"</LesHouchesEvents") ) return 0;
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int LesEventReader::readInit()
+{
+  if ( !findTag("<init") || !getline() ) return -1;
+  fortranExponents(&_line[0]);
+  char* p = &_line[0];
+  int nprup;
+  if ( !( number(p,_init.idbmup[0]) && number(p,_init.idbmup[1]) &&
+	  number(p,_init.ebmup [0]) && number(p,_init.ebmup [1]) &&
+	  number(p,_init.pdfgup[0]) && number(p,_init.pdfgup[1]) &&
+	  number(p,_init.pdfsup[0]) && number(p,_init.pdfsup[1]) &&
+	  number(p,_init.idwtup)    && number(p,nprup) ) ||
+       nprup < 0 || nprup > LES_MAXPUP ) return -1;
+  _init.xsecup.resize(nprup);
+  _init.xerrup.resize(nprup);
+  _init.xmaxup.resize(nprup);
+  _init.lprup .resize(nprup);
+  for ( int i=0; i<nprup; i++ ) {
+    if ( !getline() ) return -1;
+    fortranExponents(&_line[0]);
+    p = &_line[0];
+    if ( !( number(p,_init.xsecup[i]) && number(p,_init.xerrup[i]) &&
+	    number(p,_init.xmaxup[i]) && number(p,_init.lprup [i]) ) ) {
+      return -1;
+    }
+  }
+  return findTag("</init") ? 0 : -1;
+}
+
+//______________________________________________________________________________
+int LesEventReader::parseEvent(LesEvent& event)
+{
+  // 1 for an event, 0 at the end of the file, -1 for a broken event
+  if ( !findTag("<event") ) return 0;
+  if ( !getline() ) return -1;
+  fortranExponents(&_line[0]);
+  char* p = &_line[0];
+  int nup;
+  if ( !( number(p,nup)           && number(p,event.idprup) &&
+	  number(p,event.xwgtup)  && number(p,event.scalup) &&
+	  number(p,event.aqedup)  && number(p,event.aqcdup) ) ||
+       nup < 0 || nup > LES_MAXNUP ) return -1;
+  event.particles.resize(nup);
+  for ( int i=0; i<nup; i++ ) {
+    if ( !getline() ) return -1;
+    fortranExponents(&_line[0]);
+    p = &_line[0];
+    LesParticle& q = event.particles[i];
+    if ( !( number(p,q.idup)      && number(p,q.istup)     &&
+	    number(p,q.mothup[0]) && number(p,q.mothup[1]) &&
+	    number(p,q.icolup[0]) && number(p,q.icolup[1]) &&
+	    number(p,q.pup[0]) && number(p,q.pup[1]) && number(p,q.pup[2]) &&
+	    number(p,q.pup[3]) && number(p,q.pup[4]) &&
+	    number(p,q.vtimup)    && number(p,q.spinup) ) ) return -1;
+  }
+					// optional lines (weights, comments)
+  return findTag("</event") ? 1 : -1;
+}
+
+//______________________________________________________________________________
+void* LesEventReader::run(void* self)
+{
+  static_cast<LesEventReader*>(self)->produce();
+  return 0;
+}
+
+//______________________________________________________________________________
+void LesEventReader::produce()
+{
+  int  rc = 1;
+  long nskipped = 0;
+  for ( ; nskipped < _skip && rc == 1; nskipped++ ) {
+    if ( !findTag("<event") ) rc = 0;
+    else if ( !findTag("</event") ) rc = -1;
+  }
+  long n = nskipped;
+  while ( rc == 1 ) {
+    pthread_mutex_lock(&_mutex);
+    while ( _nFull == int(_ring.size()) && !_stop ) {
+      pthread_cond_wait(&_notFull,&_mutex);
+    }
+    int slot = _in;
+    bool stop = _stop;
+    pthread_mutex_unlock(&_mutex);
+    if ( stop ) return;
+					// the slot is ours until published
+    rc = parseEvent(_ring[slot]);
+    if ( rc != 1 ) break;
+    ++n;
+    pthread_mutex_lock(&_mutex);
+    _in = (_in+1) % _ring.size();
+    ++_nFull;
+    pthread_cond_signal(&_notEmpty);
+    pthread_mutex_unlock(&_mutex);
+  }
+
+  pthread_mutex_lock(&_mutex);
+  if ( rc < 0 ) {
+    std::ostringstream e;
+    e << "LesEventReader: broken event " << n+1 << " in " << _fileName;
+    _error = e.str();
+  }
+  _eof = true;
+  pthread_cond_broadcast(&_notEmpty);
+  pthread_mutex_unlock(&_mutex);
+}
+
+//______________________________________________________________________________
+bool LesEventReader::read(LesEvent& event)
+{
+  if ( !_running ) return false;
+  pthread_mutex_lock(&_mutex);
+  if ( _nFull == 0 && !_eof ) {
+    ++_nWaits;
+    while ( _nFull == 0 && !_eof ) pthread_cond_wait(&_notEmpty,&_mutex);
+  }
+  if ( _nFull == 0 ) {
+    pthread_mutex_unlock(&_mutex);
+    if ( !_error.empty() && !_reported ) {
+      ERRLOG(ELerror,"[LES_READER]") << _error << endmsg;
+      _reported = true;
+    }
+    return false;
+  }
+  int slot = _out;
+  pthread_mutex_unlock(&_mutex);
+					// swap, so both keep their capacity
+  LesEvent& e = _ring[slot];
+  event.idprup = e.idprup;
+  event.xwgtup = e.xwgtup;
+  event.scalup = e.scalup;
+  event.aqedup = e.aqedup;
+  event.aqcdup = e.aqcdup;
+  event.particles.swap(e.particles);
+
+  pthread_mutex_lock(&_mutex);
+  _out = (_out+1) % _ring.size();
+  --_nFull;
+  pthread_cond_signal(&_notFull);
+  pthread_mutex_unlock(&_mutex);
+  ++_nRead;
+  return true;
+}
+
+//______________________________________________________________________________
+// UPINIT/UPEVNT hooks: with -Wl,--wrap=upinit_ -Wl,--wrap=upevnt_
+// (LES_READER_CXX=1, see link_generatorMods.mk) the calls of PYTHIA and
+// HERWIG come here and go on to the Fortran readers only if no
+// LesEventReader is active. The __real_ symbols are weak, so binaries
+// linked without the wraps, which never get here, link as well.
+//
+extern "C" {
+  void __real_upinit_() __attribute__((weak));
+  void __real_upevnt_() __attribute__((weak));
+}
+
+void __wrap_upinit_()
+{
+  LesEventReader* r = LesEventReader::active();
+  if ( !r ) {
+    if ( __real_upinit_ ) __real_upinit_();
+    return;
+  }
+  LesEventReader::_hooked = true;
+  const LesInit& in = r->init();
+  for ( int k=0; k<2; k++ ) {
+    heprup_.IDBMUP[k] = in.idbmup[k];
+    heprup_.EBMUP [k] = in.ebmup [k];
+    heprup_.PDFGUP[k] = in.pdfgup[k];
+    heprup_.PDFSUP[k] = in.pdfsup[k];
+  }
+  heprup_.IDWTUP = in.idwtup;
+  heprup_.NPRUP  = in.lprup.size();
+  for ( int i=0; i<heprup_.NPRUP; i++ ) {
+    heprup_.XSECUP[i] = in.xsecup[i];
+    heprup_.XERRUP[i] = in.xerrup[i];
+    heprup_.XMAXUP[i] = in.xmaxup[i];
+    heprup_.LPRUP [i] = in.lprup [i];
+  }
+}
+
+void __wrap_upevnt_()
+{
+  LesEventReader* r = LesEventReader::active();
+  if ( !r ) {
+    if ( __real_upevnt_ ) __real_upevnt_();
+    return;
+  }
+  static LesEvent event;
+  if ( !r->read(event) ) {
+    hepeup_.NUP = 0;                    // end of file for PYTHIA/HERWIG
+    return;
+  }
+  int nup = event.particles.size();
+  hepeup_.NUP    = nup;
+  hepeup_.IDPRUP = event.idprup;
+  hepeup_.XWGTUP = event.xwgtup;
+  hepeup_.SCALUP = event.scalup;
+  hepeup_.AQEDUP = event.aqedup;
+  hepeup_.AQCDUP = event.aqcdup;
+  for ( int i=0; i<nup; i++ ) {
+    const LesParticle& q = event.particles[i];
+    hepeup_.IDUP  [i]    = q.idup;
+    hepeup_.ISTUP [i]    = q.istup;
+    hepeup_.MOTHUP[i][0] = q.mothup[0];
+    hepeup_.MOTHUP[i][1] = q.mothup[1];
+    hepeup_.ICOLUP[i][0] = q.icolup[0];
+    hepeup_.ICOLUP[i][1] = q.icolup[1];
+    memcpy(hepeup_.PUP[i],q.pup,sizeof(q.pup));
+    hepeup_.VTIMUP[i]    = q.vtimup;
+    hepeup_.SPINUP[i]    = q.spinup;
+  }
+}
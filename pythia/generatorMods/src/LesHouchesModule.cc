@@ -8,8 +8,10 @@
 //---------------
 // C++ Headers -- MUST use defects !!!!
 //---------------
+#include <stdio.h>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <math.h>
 using std::cout;
 using std::endl;
@@ -35,6 +37,8 @@ using std::string;
 #include "stdhep_i/CdfHepevt.hh"
 
 #include "generatorMods/HerwigMenu.hh"
+#include "generatorMods/LesEventIndex.hh"
+#include "generatorMods/LesEventReader.hh"
 
 extern "C" {
   void upinit_();
@@ -116,6 +120,11 @@ LesHouchesModule::LesHouchesModule() :
   _lesdatfile("LesDatFile", this, "test.dat"),
   _lespsmodel("LesPSModel", this, "PYTHIA"),
   _firstEventToRead("firstEventToRead", this, 1),
+  _useEventIndex("useEventIndex", this, true),
+  _eventIndexFile("EventIndexFile", this, ""),
+  _eventsToRead("eventsToRead", this, 0),
+  _lesReader("LesReader", this, "FORTRAN"),
+  _lesReaderQueue("LesReaderQueue", this, 100),
   _putResonance("putResonance", this, 1),
   _skipResonance("skipResonance", this,0,6,0,-30,30),
   _scaleOfKtClus("scaleOfKtClus", this, false),
@@ -124,13 +133,20 @@ LesHouchesModule::LesHouchesModule() :
   _stddatfile("StdhepFileName", this, "stdhep.dat"),
   _useStdEvent("NumOfStdEvent", this, 10),
   _pythiaMenu( new PythiaMenu( this, 0, "PythiaMenu") ),
-  _herwigMenu( new HerwigMenu( this, 0, "HerwigMenu") )
+  _herwigMenu( new HerwigMenu( this, 0, "HerwigMenu") ),
+  _psModel(PS_UNKNOWN),
+  _reader(0)
 {
   // all other grappa stuff
   commands() -> append(&_lesgentype);
   commands() -> append(&_lesdatfile);
   commands() -> append(&_lespsmodel);
   commands() -> append(&_firstEventToRead);
+  commands() -> append(&_useEventIndex);
+  commands() -> append(&_eventIndexFile);
+  commands() -> append(&_eventsToRead);
+  commands() -> append(&_lesReader);
+  commands() -> append(&_lesReaderQueue);
   commands() -> append(&_putResonance);
   commands() -> append(&_skipResonance);
   commands() -> append(&_scaleOfKtClus);
@@ -153,6 +169,32 @@ LesHouchesModule::LesHouchesModule() :
   _firstEventToRead.addDescription(
   "      \t\t\tSet the first event number to read from event file.");
 
+  _useEventIndex.addDescription(
+  "      \t\t\tStart at firstEventToRead using the byte offsets of the\n"
+  "      \t\t\t<event> blocks of an LHE LesDatFile instead of reading all\n"
+  "      \t\t\tpreceding events (not for useStdhep 2). true/false:ON/OFF");
+
+  _eventIndexFile.addDescription(
+  "      \t\t\tEvent offset index of LesDatFile, built and saved there if\n"
+  "      \t\t\tmissing or stale (see makeLesEventIndex).\n"
+  "      \t\t\tDefault: LesDatFile + \".idx\".");
+
+  _eventsToRead.addDescription(
+  "      \t\t\tNumber of events from firstEventToRead on that the job may\n"
+  "      \t\t\tread when useEventIndex is on and firstEventToRead > 1.\n"
+  "      \t\t\tOnly these events are copied to the local file read;\n"
+  "      \t\t\t0 = copy all events up to the end of file.");
+
+  _lesReader.addDescription(
+  "      \t\t\tReader of LHE LesDatFiles: FORTRAN (the ME-generator's) or\n"
+  "      \t\t\tCXX, which also reads gzip'd files and decodes events\n"
+  "      \t\t\tahead on a separate thread. CXX passes the events as they\n"
+  "      \t\t\tare in the file (no putResonance/skipResonance/scaleOfKtClus)\n"
+  "      \t\t\tand needs a binary linked with LES_READER_CXX=1.");
+
+  _lesReaderQueue.addDescription(
+  "      \t\t\tNumber of events the CXX reader decodes ahead.");
+
   _putResonance.addDescription(
   "      \t\t\tSet resonance particles (W or Z) in the event history,\n"
   "      \t\t\tif lepton pair apears sequentialy in event. 1/0:ON/OFF \n"
@@ -213,6 +255,7 @@ LesHouchesModule::~LesHouchesModule()
 {
   delete _pythiaMenu;
   delete _herwigMenu;
+  delete _reader;
 }
 
 AppResult LesHouchesModule::genBeginRun(AbsEvent* aRun) {
@@ -225,7 +268,36 @@ AppResult LesHouchesModule::genBeginJob() {
   //  Set Input parameters
   //========================
   const char* LesGenType = _lesgentype.value().c_str();
-  const char* LesDatFile = _lesdatfile.value().c_str();
+  if (_lespsmodel.value() == "PYTHIA" || _lespsmodel.value() == "Pythia") {
+    _psModel = PS_PYTHIA;
+  }
+  else if (_lespsmodel.value() == "HERWIG" || 
+	   _lespsmodel.value() == "Herwig") {
+    _psModel = PS_HERWIG;
+  }
+  else {
+    _psModel = PS_UNKNOWN;
+  }
+
+  std::string datFile = _lesdatfile.value();
+  int nskipEvents = _firstEventToRead.value()-1;
+  if ((_lesReader.value() == "CXX" || _lesReader.value() == "cxx") &&
+      _useSTDHEP.value() != 2) {
+    if (openReader(datFile,nskipEvents)) {
+      ERRLOG(ELfatal,"[LES_READER]")
+	<< "LesHouchesModule: can't read " << datFile << endmsg;
+      return AppResult::ERROR;
+    }
+    nskipEvents = 0;
+  }
+  else if (nskipEvents > 0 && _useEventIndex.value() && 
+	   _useSTDHEP.value() != 2) {
+    if (openSlice(datFile,nskipEvents) == 0) {
+      datFile = _sliceFile;
+      nskipEvents = 0;
+    }
+  }
+  const char* LesDatFile = datFile.c_str();
   const char* LesPSModel = _lespsmodel.value().c_str();
 
   _uid = LesGenType;
@@ -259,8 +331,7 @@ AppResult LesHouchesModule::genBeginJob() {
   //  To Pythia...
   //================
   if (_useSTDHEP.value() < 2) {
-    if (_lespsmodel.value() == "PYTHIA" 
-	|| _lespsmodel.value() == "Pythia") {
+    if (_psModel == PS_PYTHIA) {
 
       Pythia* pythia = Pythia::Instance();
       if(Pythia::Instance()->pydat3().lenMdme() == 8000 && 
@@ -371,8 +442,7 @@ AppResult LesHouchesModule::genBeginJob() {
     //================
     //  To Herwig...
     //================
-    else if (_lespsmodel.value() == "HERWIG" 
-	     || _lespsmodel.value() == "Herwig") {
+    else if (_psModel == PS_HERWIG) {
       // Since we may have changed parameters via Talk-to,
       // we need to refill Herwig Common blocks from the 
       // AbsParms
@@ -448,12 +518,21 @@ AppResult LesHouchesModule::genBeginJob() {
     _mxevt = lmxevt;
   }
 
+  // without the UPINIT/UPEVNT wraps the Fortran readers would read the
+  // whole file behind the reader's back
+  if (_reader && !LesEventReader::hooked()) {
+    ERRLOG(ELfatal,"[LES_READER]")
+      << "LesHouchesModule: UPINIT/UPEVNT are not wrapped (link with "
+      << "LES_READER_CXX=1), LesReader CXX can't be used" << endmsg;
+    return AppResult::ERROR;
+  }
+
   //====================================
   // Skip N events from the event file.
   //====================================
   std::cout << "The events are stored in HEPG from " 
 	    << _firstEventToRead.value() << "-th event." << std::endl;
-  for (int i = 1; i < _firstEventToRead.value(); i++) {
+  for (int i = 1; i <= nskipEvents; i++) {
     if (_useSTDHEP.value() == 2) { stdrunred_(); }
     else { Upevnt(); }
     if (i%500 == 0) { std::cout << "skip " << i << " events..." << std::endl; }
@@ -481,8 +560,7 @@ int LesHouchesModule::callGenerator(AbsEvent* anEvent) {
     }
   }
   else {
-    if (_lespsmodel.value() == "PYTHIA" 
-	|| _lespsmodel.value() == "Pythia") {
+    if (_psModel == PS_PYTHIA) {
 
       Pythia* pythia = Pythia::Instance();
 
@@ -514,8 +592,7 @@ int LesHouchesModule::callGenerator(AbsEvent* anEvent) {
 	pythia->Pylist(&mevlist); // List this event if required
       }
     }
-    else if (_lespsmodel.value() == "HERWIG" 
-	     || _lespsmodel.value() == "Herwig") {
+    else if (_psModel == PS_HERWIG) {
 
       // generates single event with HERWIG
       //* CdfHepevt* hepevt = CdfHepevt::Instance();
@@ -558,8 +635,7 @@ void LesHouchesModule::fillHepevt() {
   if (_useSTDHEP.value() == 2) {
   }
   else {
-    if (_lespsmodel.value() == "PYTHIA" 
-	|| _lespsmodel.value() == "Pythia") {
+    if (_psModel == PS_PYTHIA) {
       Pythia* pythia = Pythia::Instance();
       // Tell lunhep to convert from PYJETS to HEPEVT
       int mconv=1;                          
@@ -583,31 +659,14 @@ void LesHouchesModule::fillHepevt() {
 	}
       }
     }
-    else if (_lespsmodel.value() == "HERWIG" 
-	     || _lespsmodel.value() == "Herwig") {
+    else if (_psModel == PS_HERWIG) {
       int mconv = 1;
       hwghep_(&mconv);
 
-      Herwig* herwig = Herwig::Instance();
-      CdfHepevt::Instance()->Hepev4Ptr()->EVENTWEIGHTLH = 
-	herwig->Hwevnt()->evwgt;
-      int i = 0;
-      while ((CdfHepevt::Instance()->HepevtPtr()->ISTHEP[i] != 123)  
-	     &&  (i < CdfHepevt::Instance()->HepevtPtr()->NHEP)) {
-	i++;
-      }
-
-      float px = CdfHepevt::Instance()->HepevtPtr()->PHEP[i][0]; 
-      float py = CdfHepevt::Instance()->HepevtPtr()->PHEP[i][1]; 
-
-      float pthat = px*px+py*py;
-      if ( pthat > 0.0 ) {
-	pthat=std::sqrt(px*px+py*py);
-      }
-      else {
-	pthat = 0.;
-      }
-      CdfHepevt::Instance()->Hepev4Ptr()->SCALELH[5]  = pthat;
+      CdfHepevt* hepevt = CdfHepevt::Instance();
+      _herwigRecord.index(*hepevt->HepevtPtr());
+      _herwigRecord.fillHepev4(*hepevt->HepevtPtr(),*hepevt->Hepev4Ptr(),
+			       Herwig::Instance()->Hwevnt()->evwgt);
 
       // Fill Stdhep common block 1
       if (_useSTDHEP.value() == 1) {
@@ -623,8 +682,7 @@ void LesHouchesModule::fillHepevt() {
 
 AppResult LesHouchesModule::genEndRun(AbsEvent* aRun) {
 
-  if (_lespsmodel.value() == "PYTHIA" 
-      || _lespsmodel.value() == "Pythia") {
+  if (_psModel == PS_PYTHIA) {
     Pythia* pythia = Pythia::Instance();
     int mstat = _pythiaMenu->statlistlevel();
     std::cout << "Call PYSTAT at endRun" << std::endl;
@@ -638,13 +696,24 @@ AppResult LesHouchesModule::genEndJob() {
 
   lesendjob_();
 
+  if (!_sliceFile.empty()) {
+    remove(_sliceFile.c_str());
+    _sliceFile.clear();
+  }
+  if (_reader) {
+    std::cout << "LesHouchesModule: " << _reader->nRead() 
+	      << " events from the CXX reader, waited for the file "
+	      << _reader->nWaits() << " times" << std::endl;
+    delete _reader;
+    _reader = 0;
+  }
+
   if (_useSTDHEP.value() == 2) {
     int ipsgen = 3;
     stdrunend_(&ipsgen,&_mxevt);
   }
   else {
-    if (_lespsmodel.value() == "PYTHIA" 
-	|| _lespsmodel.value() == "Pythia") {
+    if (_psModel == PS_PYTHIA) {
       Pythia* pythia = Pythia::Instance();
       int mstat = _pythiaMenu->statlistlevel();
       std::cout << "Call PYSTAT at endJob" << std::endl;
@@ -656,8 +725,7 @@ AppResult LesHouchesModule::genEndJob() {
 	stdrunend_(&ipsgen,&_mxevt);
       }
     }
-    else if (_lespsmodel.value() == "HERWIG" 
-	     || _lespsmodel.value() == "Herwig") {
+    else if (_psModel == PS_HERWIG) {
       CdfHepevt* hepevt = CdfHepevt::Instance();
       hepevt->HepevtPtr()->NEVHEP = _events;
 
@@ -677,6 +745,75 @@ AppResult LesHouchesModule::genEndJob() {
   return AppResult::OK;
 }
 
+int LesHouchesModule::openSlice(const std::string& datFile, int nskip) {
+
+  // The Fortran readers open LesDatFile by name: hand them a local copy
+  // of the header and the requested events, located with the index,
+  // which is only scanned up to the last of these events.
+  long last = _eventsToRead.value() > 0 ? nskip+_eventsToRead.value() : -1;
+  LesEventIndex index;
+  if (index.load(datFile,_eventIndexFile.value(),last)) return -1;
+  if (index.nEvents() == 0) {
+    std::cout << "LesHouchesModule: no <event> blocks in " << datFile
+	      << ", skipping events one by one." << std::endl;
+    return -1;
+  }
+  if (nskip >= index.nEvents()) {
+    ERRLOG(ELerror,"[LES_FIRST_EVENT]")
+      << "LesHouchesModule: firstEventToRead " << nskip+1 << " but only "
+      << index.nEvents() << " events in " << datFile << endmsg;
+    return -1;
+  }
+
+  std::string base = datFile.substr(datFile.rfind('/')+1);
+  std::ostringstream slice;
+  slice << "lesSlice_" << nskip+1 << "_" << base;
+  if (index.writeSlice(datFile,slice.str(),nskip,_eventsToRead.value())) {
+    return -1;
+  }
+  _sliceFile = slice.str();
+  std::cout << "LesHouchesModule: reading events " << nskip+1 << "-"
+	    << ( last >= 0 && last < index.nEvents() ? last : index.nEvents() )
+	    << " of " << datFile << " from " << _sliceFile << std::endl;
+  return 0;
+}
+
+int LesHouchesModule::openReader(const std::string& datFile, int nskip) {
+
+  // plain files start at the indexed offset, gzip'd ones skip the
+  // events on the reading thread
+  off_t offset = 0;
+  long skip = nskip;
+  if (nskip > 0 && _useEventIndex.value() && 
+      !LesEventReader::gzipped(datFile)) {
+    LesEventIndex index;
+    if (index.load(datFile,_eventIndexFile.value(),nskip) == 0 &&
+	nskip < index.nEvents()) {
+      offset = index.offset(nskip);
+      skip = 0;
+    }
+  }
+
+  _reader = new LesEventReader;
+  if (_reader->open(datFile,_lesReaderQueue.value(),skip,offset)) {
+    delete _reader;
+    _reader = 0;
+    return -1;
+  }
+  _reader->activate();
+
+  if (_putResonance.value() || 
+      _skipResonance.begin() != _skipResonance.end() ||
+      _scaleOfKtClus.value()) {
+    ERRLOG(ELwarning,"[LES_READER]")
+      << "LesHouchesModule: putResonance, skipResonance and scaleOfKtClus"
+      << " are not applied to the events of the CXX reader" << endmsg;
+  }
+  std::cout << "LesHouchesModule: reading " << datFile 
+	    << " with the CXX reader from event " << nskip+1 << std::endl;
+  return 0;
+}
+
 void LesHouchesModule::Upinit() {upinit_(); }
 
 void LesHouchesModule::Upevnt() {upevnt_(); }
@@ -0,0 +1,164 @@
+//--------------------------------------------------------------------
+// MinBiasLibraryMenu.cc
+//
+// write / overlay a pre-generated min-bias event library
+//
+
+#include "generatorMods/MinBiasLibraryMenu.hh"
+
+#include <math.h>
+#include <iostream>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "CLHEP/Random/RandGaussT.h"
+#include "ErrorLogger_i/gERRLOG.hh"
+
+MinBiasLibraryMenu::MinBiasLibraryMenu( AppModule* target,
+					std::string menuName,
+					std::string title)
+  :
+  APPMenu(),
+  _writeFile    ("writeFile",    target, ""),
+  _compression  ("compression",  target, 6),
+  _readFile     ("readFile",     target, ""),
+  _rotatePhi    ("rotatePhi",    target, true),
+  _zSigma       ("zSigma",       target, 0.),
+  _nWritten(0),
+  _nOverlaid(0)
+{
+  initialize(menuName.c_str(),target);
+  initTitle(title.c_str());
+
+  _writeFile.addDescription(
+		"      \t\t\tLibrary file to write the generated interactions to");
+  _compression.addDescription(
+		"      \t\t\tzlib level of the written library (0-9), default 6");
+  _readFile.addDescription(
+		"      \t\t\tLibrary file to overlay interactions from instead of\n\t\t\tgenerating them");
+  _rotatePhi.addDescription(
+		"      \t\t\tRotate overlaid interactions by a random phi, default true");
+  _zSigma.addDescription(
+		"      \t\t\tSigma (mm) of the gaussian z vertex of overlaid\n\t\t\tinteractions, 0 = library origin");
+
+  commands()->append(&_writeFile);
+  commands()->append(&_compression);
+  commands()->append(&_readFile);
+  commands()->append(&_rotatePhi);
+  commands()->append(&_zSigma);
+}
+
+int MinBiasLibraryMenu::open(const char* who) {
+  if ( !_writeFile.value().empty() && !_readFile.value().empty() ) {
+    ERRLOG(ELabort,"[MINBIAS_LIBRARY_MODE]")
+      << who << ": the min-bias library can be written or read, not both"
+      << endmsg;
+    return -1;
+  }
+  if ( !_writeFile.value().empty() &&
+       _writer.open(_writeFile.value(),_compression.value()) ) {
+    ERRLOG(ELabort,"[MINBIAS_LIBRARY_OPEN]")
+      << who << ": can't create min-bias library " << _writeFile.value()
+      << endmsg;
+    return -1;
+  }
+  if ( !_readFile.value().empty() ) {
+    if ( _reader.open(_readFile.value()) || _reader.nEvents() == 0 ) {
+      ERRLOG(ELabort,"[MINBIAS_LIBRARY_OPEN]")
+	<< who << ": can't read min-bias library " << _readFile.value()
+	<< endmsg;
+      return -1;
+    }
+    std::cout << " " << who << ": overlaying " << _reader.nEvents()
+	      << " library events from " << _readFile.value() << std::endl;
+  }
+  return 0;
+}
+
+void MinBiasLibraryMenu::close(std::ostream& os, const char* who) {
+  if ( writing() ) {
+    _writer.close();
+    os << " " << who << ": " << _nWritten << " interactions written to "
+       << "min-bias library " << _writeFile.value() << std::endl;
+  }
+  if ( reading() ) {
+    _reader.close();
+    os << " " << who << ": " << _nOverlaid << " interactions overlaid from "
+       << "min-bias library " << _readFile.value() << std::endl;
+  }
+}
+
+void MinBiasLibraryMenu::record(const HEPEVT& hep, const HEPEV4& hep4) {
+  _writer.addInteraction(hep,hep4);
+  if ( _writer.writeEvent() ) {
+    ERRLOG(ELerror,"[MINBIAS_LIBRARY_WRITE]")
+      << "MinBiasLibraryMenu: write error on " << _writeFile.value()
+      << endmsg;
+    return;
+  }
+  _nWritten++;
+}
+
+int MinBiasLibraryMenu::overlay(HepRandomEngine* engine,
+				HEPEVT& hep, HEPEV4& hep4) {
+					// library event, then one of its
+					// interactions (one unless the file
+					// was written by GenOutputManager)
+					// (another one if it can't be read)
+  int ntry = 0;
+  while ( true ) {
+    long i = RandFlat::shootInt(engine,_reader.nEvents());
+    if ( _reader.readEvent(i) == 0 && _reader.nInteractions() > 0 ) break;
+    ERRLOG(ELerror,"[MINBIAS_LIBRARY_READ]")
+      << "MinBiasLibraryMenu: can't read event " << i << " of "
+      << _readFile.value() << endmsg;
+    if ( ++ntry >= MAXREADTRIES ) {
+      ERRLOG(ELabort,"[MINBIAS_LIBRARY_READ]")
+	<< "MinBiasLibraryMenu: " << ntry << " unreadable events in a row, "
+	<< _readFile.value() << " is corrupt" << endmsg;
+      hep.NHEP = 0;
+      return -1;
+    }
+  }
+  int k = 0;
+  if ( _reader.nInteractions() > 1 ) {
+    k = RandFlat::shootInt(engine,_reader.nInteractions());
+  }
+  _reader.fillInteraction(k,hep,hep4);
+
+  const int n = hep.NHEP;
+  if ( _rotatePhi.value() ) {
+    double phi = 2.*M_PI*RandFlat::shoot(engine);
+    double c = cos(phi);
+    double s = sin(phi);
+    for ( int j=0; j<n; j++ ) {
+      double* p = hep.PHEP[j];
+      double* v = hep.VHEP[j];
+      double px = p[0];
+      double vx = v[0];
+      p[0] = c*px - s*p[1];
+      p[1] = s*px + c*p[1];
+      v[0] = c*vx - s*v[1];
+      v[1] = s*vx + c*v[1];
+    }
+  }
+					// the library vertex becomes the
+					// origin, then the new z
+  if ( n > 0 ) {
+    double v0[4] = { hep.VHEP[0][0], hep.VHEP[0][1],
+		     hep.VHEP[0][2], hep.VHEP[0][3] };
+    double z = 0.;
+    if ( _zSigma.value() > 0. ) {
+      z = RandGaussT::shoot(engine,0.,_zSigma.value());
+    }
+    for ( int j=0; j<n; j++ ) {
+      double* v = hep.VHEP[j];
+      v[0] -= v0[0];
+      v[1] -= v0[1];
+      v[2] -= v0[2] - z;
+      v[3] -= v0[3];
+    }
+  }
+  _nOverlaid++;
+  return 0;
+}
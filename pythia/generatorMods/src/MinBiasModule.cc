@@ -23,6 +23,7 @@
 //         Apr 08 2002 anwar:  fix gcc problem
 //         Nov 05 2002 anwar:  Move add_particle_HepEvt from MinBias MinBiasModule.cc
 #include <string>
+#include <vector>
 #include <math.h>
 
 #include "Framework/APPFramework.hh"
@@ -55,6 +56,7 @@ const long MinBiasModule::_defaultRandomSeed1 = 92253591;
 const long MinBiasModule::_defaultRandomSeed2 = 35476;
 
 HepRandomEngine* MinBiasModule::minBiasEngine = 0;
+InverseCdfTable  MinBiasModule::_o2Table;
 
 //----------------
 // Constructors --
@@ -80,9 +82,12 @@ MinBiasModule::MinBiasModule()
     _epsilon( "epsilon", this, 0.104 ),
     _sigpomp( "sigpomp", this, 2.82 ),
     _alpha( "alpha", this, 0.25 ),
+    _kinTables( "kin_tables", this, 1 ),
+    _library( this ),
     _randomSeed1("RandomSeed1",this,MinBiasModule::_defaultRandomSeed1),
     _randomSeed2("RandomSeed2",this,MinBiasModule::_defaultRandomSeed2)
 {
+  _kinNext = 0;
   _process.addDescription(
 "  Choose a combination of Hard Core, Double-, Single-Diffractive, Elastic:\n\
    Process type=1*HC+10*DD+100*SD+1000*EL, eg 101=HC+SD\n\
@@ -137,6 +142,9 @@ MinBiasModule::MinBiasModule()
 "  Enter the value of the total pomeron-proton cross section in mb (2.82)");
   _alpha.addDescription(
 "  Enter the value of alpha' to be used in the pomeron trajectory (0.25)");
+  _kinTables.addDescription(
+"  Sample the fire-ball particle pt and rapidity from tables built at\n\
+    beginJob, in one batch per cluster: 0=old per call sampling 1=tables (1)");
 
   commands( )->append( &_process);
   commands( )->append( &_pbeam);
@@ -156,6 +164,8 @@ MinBiasModule::MinBiasModule()
   commands( )->append( &_epsilon);
   commands( )->append( &_sigpomp);
   commands( )->append( &_alpha);
+  commands( )->append( &_kinTables);
+  commands( )->append( &_library);
 
 // Initialize the relevant submenu
   _randomNumberMenu.initialize("RandomNumberMenu",this);
@@ -189,6 +199,12 @@ int MinBiasModule::callGenerator(AbsEvent* event){
   CdfHepevt* hepevt = CdfHepevt::Instance();
   hepevt->clearCommon();
   
+  if (_library.reading()) {
+					// errors are logged by the menu
+    _library.overlay(AbsGenModule::absGenEngine,
+		     *hepevt->HepevtPtr(),*hepevt->Hepev4Ptr());
+    return 0;
+  }
   mbr_generate_event();
   return 0;
 }
@@ -205,6 +221,9 @@ AppResult  MinBiasModule::genBeginJob(){
   MinBiasModule::minBiasEngine = CdfRn::Instance()->GetEngine(MinBiasModule::genId);
 
   initEvent();
+  if (_kinTables.value()) build_kinematics_tables();
+
+  if (_library.open(name())) return AppResult::ERROR;
 
   return AppResult::OK;
 }
@@ -222,10 +241,17 @@ AppResult  MinBiasModule::genEndRun(AbsEvent* anEvent){
 //_____________________________________________________________________________
 
 AppResult  MinBiasModule::genEndJob(){
+  _library.close(std::cout,name());
   return AppResult::OK;
 }
 
-void MinBiasModule::fillHepevt() { writeHEPGbank(); }
+void MinBiasModule::fillHepevt() { 
+  if (_library.writing()) {
+    CdfHepevt* hepevt = CdfHepevt::Instance();
+    _library.record(*hepevt->HepevtPtr(),*hepevt->Hepev4Ptr());
+  }
+  writeHEPGbank(); 
+}
        
 void MinBiasModule::writeHEPGbank() {
 
@@ -1629,9 +1655,19 @@ void  MinBiasModule::generate_one_particle_from_fire_ball(int ngenpa, int itype,
   double* hp  = hepevt->HepevtPtr()->PHEP[ngenpa-1];
   double  amx = hp[4];
 
-  double y=generate_rapidiy(amx);
-  double pt=generate_pt(amx,nt);
-  double phi=twopi*RandFlat::shoot(engine);
+  double y,pt,phi;
+  if (_kinNext<int(_kinY.size())) {
+					// batch of the current cluster
+    y=_kinY[_kinNext];
+    pt=_kinPt[_kinNext];
+    phi=_kinPhi[_kinNext];
+    _kinNext++;
+  }
+  else {
+    y=generate_rapidiy(amx);
+    pt=generate_pt(amx,nt);
+    phi=twopi*RandFlat::shoot(engine);
+  }
   double mass=pamass(itype);
 
   //  compute kinematical variables using rapidity,pt and mass
@@ -1990,65 +2026,33 @@ double  MinBiasModule::generate_random_o2(void){
   //  OUTPUT:  XRAN R*4 is the generated random number in [0,1]
 
   HepRandomEngine* engine = MinBiasModule::minBiasEngine;
-  double xran;
-
-  int    ipt;
-  double xmin,xmax,dx,fsum,rn;
-  double f[501];
-  double x[501];
-  int    init=0;
 
   // PROBABILITY DENSITY  function
   //  pfun(y)=1.0+cos(y)**2           inline function
 
-  xmin=0.0;
-  xmax=pi;
-
   //*********************************************************
-  if (init==0) {
+  if (_o2Table.empty()) {
 
     // integrate and invert numerically the function PFUN
-    // at the end F[i] will contain the normalized integral
-    // from XMIN to I, and X[i] the value of the corrisponding
-    // inverse function
-
-    dx=(xmax-xmin)/500.0;
+    // at the end the table will contain the normalized integral
+    // from XMIN to I, and the value of the corrisponding
+    // inverse function; it only depends on PFUN, so it is done
+    // once per job
+
+    double xmin=0.0;
+    double xmax=pi;
+    double dx=(xmax-xmin)/500.0;
+    std::vector<double> x(501), w(500);
     x[0]=xmin;
-    f[0]=0.;
     for(int i=0;i<500;i++){
       x[i+1]=x[i]+dx;
-      f[i+1]=f[i]+pfun(x[i]-.5*dx);
-    }
-          
-    fsum=f[500];
-
-    //  normalize the integral
-
-    for(int i=0;i<500;i++){
-      f[i+1]=f[i+1]/fsum;
+      w[i]=pfun(x[i]-.5*dx);
     }
-    init=1;
+    _o2Table.init(x,w);
   }
 
-  ipt =-1;        
-  while(ipt<0) {
-    rn=1.1;
-    while (rn<=0.||rn>1.) {
-      rn=RandFlat::shoot(engine);
-    }
-
-    //   invert the integral funcion
-    for (int i=0;i<500;i++) {
-      ipt=i;
-      if(rn <=f[i+1]) {
-        ipt=i;
-        //  interpolate linearly for better accuracy
-        xran=x[i]+(rn-f[i])*((x[i+1]-x[i])/(f[i+1]-f[i]));
-        return xran;
-      }
-    }
-  }
-  return 0.0;
+  //   invert the integral funcion
+  return _o2Table.shoot(engine);
 }
 
 //_____________________________________________________________________________
@@ -2180,6 +2184,136 @@ double    MinBiasModule::generate_pt(double amx,int nt){
 
 //_____________________________________________________________________________
 
+void  MinBiasModule::build_kinematics_tables(void){
+
+  //**********************************************************
+  //
+  // Builds once per job the normalized integrals of the
+  // generate_pt power law, f3(pt,ptsoft,power), with the same
+  // 500 cells as generate_pt. The power depends on the cluster
+  // mass only above 60 GeV, so the tables are made on a grid
+  // in log(mass) from 60 GeV to the CM energy.
+  //----------------------------------------------------------
+
+  double ptmax=50.;
+  double ptsoft=1.27;
+  double dxpt=0.5*ptmax/500.;
+
+  double amhi=(tecm>61.) ? tecm : 61.;
+  _ptLogAm0=log(60.);
+  _ptDLogAm=(log(amhi)-_ptLogAm0)/double(NPTTABLES);
+
+  std::vector<double> pt3(501), w(500);
+  for(int k=0;k<=NPTTABLES;k++){
+    double am=exp(_ptLogAm0+k*_ptDLogAm);
+    if (k==0) am=60.;
+    double power=4.+35.83/log(am/0.3);
+    pt3[0]=0.;
+    for(int i=0;i<500;i++){
+      double xpt=double(i+1)*ptmax/500.;
+      pt3[i+1]=xpt;
+      w[i]=f3(xpt-dxpt,ptsoft,power);
+    }
+    _ptTable[k].init(pt3,w);
+  }
+  _kinNext=0;
+  _kinY.clear();
+}
+
+//_____________________________________________________________________________
+
+double  MinBiasModule::pt_from_table(double amx,int nt,double rn){
+
+  //**********************************************************
+  //
+  // generate_pt from the tables of build_kinematics_tables:
+  // below 60 GeV the exact 60 GeV table is used, above the
+  // inverse integrals of the two neighbouring grid masses are
+  // interpolated linearly in log(mass). RN is the first flat
+  // random number, further ones are drawn only for the Pt cut
+  // of very low masses.
+  //----------------------------------------------------------
+
+  HepRandomEngine* engine = MinBiasModule::minBiasEngine;
+
+  double ptcut=amx/double(nt);
+  double xl=0.;
+  int    k=0;
+  if (amx>60.) {
+    xl=(log(amx)-_ptLogAm0)/_ptDLogAm;
+    k=int(xl);
+    if (k>=NPTTABLES) k=NPTTABLES-1;
+    xl=xl-k;
+  }
+
+  int count=0;
+
+  for (;;) {
+    double pt=_ptTable[k].invert(rn);
+    if (xl>0.) pt=pt+xl*(_ptTable[k+1].invert(rn)-pt);
+    if(!(amx<4.0 && pt>ptcut)) return pt;
+    if(count++>500) return 0;
+    rn=RandFlat::shoot(engine);
+  }
+}
+
+//_____________________________________________________________________________
+
+double  MinBiasModule::rapidity_from_flat(double amx,double rn){
+
+  //**********************************************************
+  //
+  // Same trapezoid as generate_rapidiy, flat up to
+  // flatRapidityRegion*log(AMX) and linear down to zero at
+  // log(AMX), by inverting its integral: one flat random
+  // number and no rejection.
+  //----------------------------------------------------------
+
+  double eee=flatRapidityRegion;
+  double v=2.*rn-1.;
+  double w=fabs(v)*0.5*(1.+eee);
+  double t;
+
+  if (w<=eee) {
+    t=w;
+  }
+  else {
+    double r=(w-eee)/(1.-eee);
+    t=eee+(1.-eee)*(1.-sqrt(fabs(1.-2.*r)));
+  }
+  double y=log(amx)*t;
+  return (v<0.) ? -y : y;
+}
+
+//_____________________________________________________________________________
+
+void  MinBiasModule::generate_fire_ball_kinematics(double amx,int nt,int n){
+
+  //**********************************************************
+  //
+  // Draws rapidity, Pt and phi of the N particles that
+  // generate_one_particle_from_fire_ball will add for the
+  // current cluster, with one array of 3*N flat numbers.
+  //----------------------------------------------------------
+
+  HepRandomEngine* engine = MinBiasModule::minBiasEngine;
+
+  _kinRn.resize(3*n);
+  _kinY.resize(n);
+  _kinPt.resize(n);
+  _kinPhi.resize(n);
+  if (n>0) RandFlat::shootArray(engine,3*n,&_kinRn[0]);
+
+  for(int i=0;i<n;i++){
+    _kinY  [i]=rapidity_from_flat(amx,_kinRn[3*i]);
+    _kinPt [i]=pt_from_table(amx,nt,_kinRn[3*i+1]);
+    _kinPhi[i]=twopi*_kinRn[3*i+2];
+  }
+  _kinNext=0;
+}
+
+//_____________________________________________________________________________
+
 int MinBiasModule::fragment_cluster(int ngenmx,double pxcm[4],int icharg){
   //
   //     This is a general subroutine to simulate at least in an
@@ -2378,6 +2512,20 @@ int MinBiasModule::fragment_cluster(int ngenmx,double pxcm[4],int icharg){
      ikinc=0;
 
      do {
+       if (_kinTables.value()) {
+         // same bookkeeping as the generation below
+         int nch1=nch, nn1=nn, n=0;
+         if(ip1!=0){
+           n++;
+           if(flag) nch1--; else nn1--;
+         }
+         if(ip2!=0){
+           n++;
+           nch1--;
+         }
+         n=n+nch1/2*2+nn1;
+         generate_fire_ball_kinematics(amx,nt,n);
+       }
        if(ip1!=0){
          generate_one_particle_from_fire_ball(ngenmx,ip1,nt);
          if(flag) {
@@ -2402,6 +2550,7 @@ int MinBiasModule::fragment_cluster(int ngenmx,double pxcm[4],int icharg){
          generate_one_particle_from_fire_ball(ngenmx,PSPIZ,nt);
        }
 
+       _kinY.clear();
        ier1=balance_energy_momentum(amx,ngen0); 
 
        if(ier1!=0) {         // reset pointers for the new try
@@ -2425,23 +2574,28 @@ int MinBiasModule::fragment_cluster(int ngenmx,double pxcm[4],int icharg){
 
   //    Boost event to center of mass frame
 
-   double v1[4],v2[4];
-
    int numberOfParticles=hepevt->HepevtPtr()->NHEP;
-   for(int i=ngen0-1;i<numberOfParticles;i++){
-					// kludge for EGCS/SGI
-     double* hp = hepevt->HepevtPtr()->PHEP[i];
-     for (int j=0;j<4;j++) {
-       v1[j]=hp[j];
-     }
+   int nboost=numberOfParticles-(ngen0-1);
+   if (nboost<=0) return 0;
 
-     v1[3]=sqrt(v1[0]*v1[0]+v1[1]*v1[1]+v1[2]*v1[2]+hp[4]*hp[4]);
+   _cluster.resize(nboost);
+   for(int i=0;i<nboost;i++){
+					// kludge for EGCS/SGI
+     double* hp = hepevt->HepevtPtr()->PHEP[ngen0-1+i];
+     _cluster.px[i]=hp[0];
+     _cluster.py[i]=hp[1];
+     _cluster.pz[i]=hp[2];
+     _cluster.e [i]=sqrt(hp[0]*hp[0]+hp[1]*hp[1]+hp[2]*hp[2]+hp[4]*hp[4]);
+   }
 
-     add_lorentz_boost(pxcm,v1,v2);
+   GenDecayKernel::boost(pxcm,_cluster,0,nboost);
 
-     for (int j=0;j<4;j++) {
-       hp[j]=v2[j];
-     }
+   for(int i=0;i<nboost;i++){
+     double* hp = hepevt->HepevtPtr()->PHEP[ngen0-1+i];
+     hp[0]=_cluster.px[i];
+     hp[1]=_cluster.py[i];
+     hp[2]=_cluster.pz[i];
+     hp[3]=_cluster.e [i];
    }
    return 0;
 }
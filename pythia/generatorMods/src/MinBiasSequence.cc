@@ -3,6 +3,11 @@
 //
 // created July 30 2001, Elena Gerchtein (CMU)
 //
+// min-bias library mode: each module of the sequence has a
+// MinBiasLibraryMenu to write its interactions to a library file,
+// or to overlay random library events instead of generating
+// (see examples/mbr/mbr_library.tcl)
+//
 
 #include "generatorMods/MinBiasSequence.hh"
 
@@ -10,6 +10,8 @@
 #include <iostream> 
 
 #include <sstream>
+#include <string.h>
+#include <math.h>
 using std::ostream;
 using std::cout;
 using std::endl;
@@ -21,6 +23,7 @@ using std::ostringstream ;
 // This Class's Header --
 //-----------------------
 #include "generatorMods/MixFakeEv.hh"
+#include "generatorMods/GenValueBatch.hh"
 
 //-------------------------------
 // Collaborating Class Headers --
@@ -36,6 +39,7 @@ using std::ostringstream ;
 #include "CLHEP/Random/RandFlat.h"
 #include "CLHEP/Random/RandGaussT.h"
 #include "CLHEP/Random/RandomEngine.h"
+#include "ErrorLogger_i/gERRLOG.hh"
 #include "SimulationObjects/HEPG_StorableBank.hh"
 #include "Edm/Handle.hh"
 //-----------------------------------------------------------------------
@@ -53,17 +57,21 @@ MixFakeEv::MixFakeEv() :
   AbsGenModule( MixFakeEv::genId, "Single Particle Gun Module" ),
   _useCommand("use",this),
   _genCommand("generate",this),
+  _recipeCommand("recipe",this),
   _randomSeed1("RandomSeed1",this,MixFakeEv::_defaultRandomSeed1),
   _randomSeed2("RandomSeed2",this,MixFakeEv::_defaultRandomSeed2),
   _genMom(50.,0.,  1.,100.,0.,1), // default parameters
   _genPt(50.,0.,  1.,100.,0.,1),
   _genTheta(90.,0.,-45., 45.,0.,1),
   _genEta(0.0,0., -1.,  1.,0.,2),
-  _genPhi(7.5,0.,  0.,360.,0.,2)
+  _genPhi(7.5,0.,  0.,360.,0.,2),
+  _library(this)
 {
 
   commands()->append(&_useCommand);
   commands()->append(&_genCommand);
+  commands()->append(&_recipeCommand);
+  commands()->append(&_library);
   _initializeRandomTalkTo();
                                         // <a name="qq">
                                         // Fill default values for data
@@ -233,6 +241,43 @@ static void process_use_command(MixFakeEv* module, int argc, char** argv) {
 
 
 
+static int process_recipe_command(MixFakeEv* module, int argc, char** argv) {
+  char cmd[100];
+
+  if (argc <= 0) return -1;
+  for (int j=0; j<=strlen(argv[0]) && j<99; j++) cmd[j]=toupper(argv[0][j]);
+  cmd[99] = 0;
+
+  if (strcmp(cmd,"CLEAR") == 0) {
+    module->clearRecipes();
+    return 1;
+  }
+  if (argc < 2) {
+    std::cout << " recipe: syntax is recipe CDFCODE N [FIXED|POISSON"
+	      << " [cone [histFile]]]" << std::endl;
+    return -1;
+  }
+  int    code    = atoi(argv[0]);
+  double mean    = atof(argv[1]);
+  int    poisson = 0;
+  if (argc > 2) {
+    for (int j=0; j<=strlen(argv[2]) && j<99; j++) cmd[j]=toupper(argv[2][j]);
+    cmd[99] = 0;
+    if      (strcmp(cmd,"POISSON") == 0) poisson = 1;
+    else if (strcmp(cmd,"FIXED"  ) != 0) {
+      std::cout << " recipe: unknown multiplicity " << argv[2] 
+		<< ", use FIXED or POISSON" << std::endl;
+      return -1;
+    }
+  }
+  double      cone = (argc > 3) ? atof(argv[3]) : 0.;
+  const char* file = (argc > 4) ? argv[4]       : "";
+
+  return (module->addRecipe(code,mean,poisson,cone,file) == 0) ? 1 : -2;
+}
+
+
+
 void MixFakeEv::menuHandler(char* menu, char* command, int argc, char** argv) {
   char cmd[100];
   for (int j=0; j<=strlen(command); j++) cmd[j]=toupper(command[j]);
@@ -245,6 +290,9 @@ void MixFakeEv::menuHandler(char* menu, char* command, int argc, char** argv) {
   else if (strcmp(cmd,"USE") == 0) {
     process_use_command(this,argc,argv);
   }
+  else if (strcmp(cmd,"RECIPE") == 0) {
+    process_recipe_command(this,argc,argv);
+  }
 }
 
 
@@ -253,6 +301,19 @@ int MixFakeEv::callGenerator(AbsEvent* event) {
   CdfHepevt* hepevt_my = CdfHepevt::Instance();
   hepevt_my->clearCommon();
 
+  if (_library.reading()) {
+					// errors are logged by the menu
+    _library.overlay(AbsGenModule::absGenEngine,
+		     *hepevt_my->HepevtPtr(),*hepevt_my->Hepev4Ptr());
+    return 0;
+  }
+
+  if (!_recipes.empty()) {
+    RecipeKinematics kin(this);
+    return _recipes.generate(MixFakeEv::mixFakeEvEngine,kin,
+			     *hepevt_my->HepevtPtr());
+  }
+
   double pt, p, eta, theta, phi;
   double px, py, pz;
 
@@ -318,7 +379,12 @@ int MixFakeEv::callGenerator(AbsEvent* event) {
 
 // part of the code should be moved from callGenerator - lena
 
-void MixFakeEv::fillHepevt() { }
+void MixFakeEv::fillHepevt() { 
+  if (_library.writing()) {
+    CdfHepevt* hepevt = CdfHepevt::Instance();
+    _library.record(*hepevt->HepevtPtr(),*hepevt->Hepev4Ptr());
+  }
+}
 //void MixFakeEv::fillHepevt() { writeHEPGbank();}
 /*
 void  MixFakeEv::writeHEPGbank() {
@@ -364,6 +430,15 @@ void MixFakeEv::PrintState(std::ostream& output) const {
     output << "     Theta    "; _genTheta.print(output);
   }
   output <<   "     Phi      "; _genPhi.print(output);
+
+  for (int i=0; i<_recipes.size(); i++) {
+    const GenFakeRecipes::Recipe& r = _recipes.recipe(i);
+    output << "     Recipe " << i << " : CdfCode " << r.cdfCode 
+	   << (r.poisson ? " Poisson mean " : " fixed N ") << r.mean
+	   << " cone " << r.cone;
+    if (!r.histFile.empty()) output << " hist " << r.histFile;
+    output << std::endl;
+  }
 }
 
 //______________________________________________________________________________
@@ -391,6 +466,9 @@ int MixFakeEvCommand::handle(int argc, char* argv[])
   else if(strncmp(command(),"use",3)==0) {
     target()->menuHandler("FAKE_EVENT","USE", argc-1, argv+1);
   }
+  else if(strncmp(command(),"recipe",6)==0) {
+    target()->menuHandler("FAKE_EVENT","RECIPE", argc-1, argv+1);
+  }
   else {
     std::cout << " unknown command " << command() << std::endl;
   }
@@ -465,6 +543,16 @@ string MixFakeEvCommand::description() const {
     retval += "\t\t syntax is:  use variable\n";
     retval += "\t\t where variable means P, PT, THETA, ETA\n";
   }
+  else if(strncmp(command(),"recipe",6)==0) {
+    retval += "add a particle recipe, the event is made of all recipes\n";
+    retval += "\t\t syntax is:  recipe CDFCODE N [FIXED|POISSON [cone [histFile]]]\n";
+    retval += "\t\t N is the (Poisson mean) multiplicity, cone the gaussian\n";
+    retval += "\t\t width in eta and phi (radians) around a random axis,\n";
+    retval += "\t\t histFile a GenHistSampler file of PT or P (x) and\n";
+    retval += "\t\t ETA or THETA in degrees (y; ETA distance from the\n";
+    retval += "\t\t axis when cone > 0); unset variables use the generate\n";
+    retval += "\t\t parameters.  recipe CLEAR removes all recipes\n";
+  }
   else {
     std::cout << " unknown command " << command() << std::endl;
   }
@@ -492,11 +580,26 @@ AppResult MixFakeEv::genBeginJob() {
 
   MixFakeEv::mixFakeEvEngine = CdfRn::Instance()->GetEngine("FAKE_EVENT");
 
+  for (int i=0; i<_recipes.size(); i++) {
+    GenFakeRecipes::Recipe& r = _recipes.recipe(i);
+    r.pdgId = ParticleDb::Instance()->ParticlePdgCode(r.cdfCode);
+    r.mass  = ParticleDb::Instance()->Mass(r.cdfCode);
+    if (r.histFile.empty()) continue;
+    if (r.hist.read(r.histFile)) {
+      ERRLOG(ELabort,"[MIX_FAKE_EVENT_RECIPE]")
+	<< name() << ": can't use histogram file " << r.histFile << endmsg;
+      return AppResult::ERROR;
+    }
+  }
+
+  if (_library.open(name())) return AppResult::ERROR;
+
   return AppResult::OK;
 }
 
 //_____________________________________________________________________________
 AppResult MixFakeEv::genEndJob() {
+  _library.close(std::cout,name());
   return AppResult::OK;
 }
     
@@ -576,3 +679,53 @@ void MixFakeEv::GenPars::print(std::ostream& os) const {
 }
 
 
+
+//------------------------------------------------------------------------------
+int MixFakeEv::addRecipe(int code, double mean, int poisson, double cone,
+			 const char* histFile) {
+  return _recipes.add(code,mean,poisson,cone,histFile);
+}
+
+//------------------------------------------------------------------------------
+// n values of one variable, same numbers as n calls of generateValue
+//------------------------------------------------------------------------------
+void MixFakeEv::generateValues(const GenPars& pars, int n, double* out) const {
+  GenValueBatch::Shape shape = GenValueBatch::OTHER;
+  if (pars.mode() == 1) shape = GenValueBatch::GAUSSIAN;
+  else if ((pars.mode() == 2 || pars.mode() == 3) && !pars.power()) {
+    shape = GenValueBatch::FLAT;
+  }
+  if (!GenValueBatch::shootArray(MixFakeEv::mixFakeEvEngine,shape,n,out,
+                                 pars.mean(),pars.sigma(),
+                                 pars.min(),pars.max())) {
+    for (int i=0; i<n; i++) out[i] = generateValue(pars);
+  }
+}
+
+//------------------------------------------------------------------------------
+// the generate parameters for GenFakeRecipes, n values per call; THETA is
+// in degrees and turned into ETA, PHI into radians
+//------------------------------------------------------------------------------
+bool MixFakeEv::RecipeKinematics::usePt() const {
+  return _module->UsePt;
+}
+
+void MixFakeEv::RecipeKinematics::momentum(int n, double* p) {
+  _module->generateValues(_module->UsePt ? _module->_genPt : _module->_genMom,
+			  n,p);
+}
+
+void MixFakeEv::RecipeKinematics::polar(int n, double* v) {
+  _module->generateValues(_module->UseEta ? _module->_genEta
+			                  : _module->_genTheta,n,v);
+}
+
+void MixFakeEv::RecipeKinematics::toEta(int n, double* v) {
+  if (_module->UseEta) return;
+  for (int i=0; i<n; i++) v[i] = -log(tan(0.5*DEGRAD*v[i]));
+}
+
+void MixFakeEv::RecipeKinematics::phi(int n, double* v) {
+  _module->generateValues(_module->_genPhi,n,v);
+  for (int i=0; i<n; i++) v[i] *= DEGRAD;
+}
@@ -0,0 +1,187 @@
+//--------------------------------------------------------------------------
+// PileupSampler
+//
+// alias table sampling of the number of primary interactions
+//
+//------------------------------------------------------------------------
+#include <math.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/PileupSampler.hh"
+
+//______________________________________________________________________________
+PileupSampler::PileupSampler()
+  : _mode(FIXED),
+    _fixed(1)
+{ }
+
+//______________________________________________________________________________
+void PileupSampler::addPoisson(std::vector<double>& pmf, double mu, double w)
+{
+  if ( mu <= 0. ) {
+    if ( pmf.empty() ) pmf.resize(1,0.);
+    pmf[0] += w;
+    return;
+  }
+					// far enough in the tail to lose
+					// nothing at double precision
+  int nmax = int(mu + 10.*sqrt(mu) + 20.);
+  if ( int(pmf.size()) < nmax+1 ) pmf.resize(nmax+1,0.);
+  double lmu = log(mu);
+  for ( int n=0; n<=nmax; n++ ) {
+    pmf[n] += w*exp(n*lmu - mu - lgamma(n+1.));
+  }
+}
+
+//______________________________________________________________________________
+void PileupSampler::init(Mode mode, double mean)
+{
+  _mode  = mode;
+  _fixed = ( mean > 0. ) ? int(mean) : 0;
+  std::vector<double> pmf;
+  if ( mode == FIXED ) {
+    pmf.resize(_fixed+1,0.);
+    pmf[_fixed] = 1.;
+  }
+  else {
+    addPoisson(pmf,mean,1.);
+    if ( mode == TRUNCPOISSON ) pmf[0] = 0.;
+  }
+  initTable(pmf);
+}
+
+//______________________________________________________________________________
+int PileupSampler::readProfile(const std::string& fileName)
+{
+  _profile.clear();
+  std::ifstream in(fileName.c_str(), std::ios::in | std::ios::binary);
+  if ( !in ) {
+    ERRLOG(ELerror,"[GEN_PILEUP_PROFILE]")
+      << "PileupSampler: can't open pile-up profile " << fileName << endmsg;
+    return -1;
+  }
+
+  char magic[8];
+  in.read(magic,8);
+  if ( in.gcount() == 8 && strncmp(magic,"PUPROF01",8) == 0 ) {
+    int nrec = 0;
+    in.read((char*) &nrec, sizeof(nrec));
+    for ( int i=0; i<nrec && in; i++ ) {
+      ProfileBin b;
+      in.read((char*) &b.run   , sizeof(b.run));
+      in.read((char*) &b.weight, sizeof(b.weight));
+      in.read((char*) &b.mean  , sizeof(b.mean));
+      if ( in ) _profile.push_back(b);
+    }
+    if ( int(_profile.size()) != nrec ) {
+      ERRLOG(ELerror,"[GEN_PILEUP_PROFILE]")
+	<< "PileupSampler: truncated binary profile " << fileName << endmsg;
+      _profile.clear();
+      return -1;
+    }
+  }
+  else {
+    in.clear();
+    in.seekg(0);
+    std::string line;
+    while ( std::getline(in,line) ) {
+      std::string::size_type c = line.find('#');
+      if ( c != std::string::npos ) line.erase(c);
+      std::istringstream is(line);
+      ProfileBin b;
+      if ( is >> b.run >> b.weight >> b.mean ) _profile.push_back(b);
+    }
+  }
+
+  if ( _profile.empty() ) {
+    ERRLOG(ELerror,"[GEN_PILEUP_PROFILE]")
+      << "PileupSampler: no bins in pile-up profile " << fileName << endmsg;
+    return -1;
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int PileupSampler::initProfile(int run)
+{
+  _mode = PROFILE;
+					// bins of this run, or the run 0
+					// default bins if there are none
+  std::vector<double> pmf;
+  int nbins = 0;
+  for ( int pass=0; pass<2 && nbins==0; pass++ ) {
+    int key = ( pass == 0 ) ? run : 0;
+    for ( std::vector<ProfileBin>::const_iterator b = _profile.begin();
+	  b != _profile.end(); ++b ) {
+      if ( b->run != key || b->weight <= 0. ) continue;
+      addPoisson(pmf,b->mean,b->weight);
+      nbins++;
+    }
+  }
+  if ( nbins ) initTable(pmf);
+  return nbins;
+}
+
+//______________________________________________________________________________
+void PileupSampler::initTable(const std::vector<double>& weights)
+{
+  // Walker/Vose alias method
+  int k = weights.size();
+  double sum = 0.;
+  for ( int i=0; i<k; i++ ) sum += weights[i];
+
+  _pmf  .assign(k,0.);
+  _prob .assign(k,1.);
+  _alias.assign(k,0);
+  if ( k == 0 || sum <= 0. ) {
+    _pmf.assign(1,1.);
+    _prob.assign(1,1.);
+    _alias.assign(1,0);
+    return;
+  }
+
+  std::vector<double> scaled(k);
+  std::vector<int>    small, large;
+  for ( int i=0; i<k; i++ ) {
+    _pmf[i]   = weights[i]/sum;
+    scaled[i] = _pmf[i]*k;
+    _alias[i] = i;
+    if ( scaled[i] < 1. ) small.push_back(i);
+    else                  large.push_back(i);
+  }
+  while ( !small.empty() && !large.empty() ) {
+    int s = small.back(); small.pop_back();
+    int l = large.back(); large.pop_back();
+    _prob [s] = scaled[s];
+    _alias[s] = l;
+    scaled[l] = (scaled[l] + scaled[s]) - 1.;
+    if ( scaled[l] < 1. ) small.push_back(l);
+    else                  large.push_back(l);
+  }
+					// leftovers are 1 up to rounding
+  while ( !large.empty() ) { _prob[large.back()] = 1.; large.pop_back(); }
+  while ( !small.empty() ) { _prob[small.back()] = 1.; small.pop_back(); }
+}
+
+//______________________________________________________________________________
+int PileupSampler::shoot(HepRandomEngine* engine) const
+{
+  if ( _mode == FIXED ) return _fixed;
+  int    k = _prob.size();
+  double u = engine->flat()*k;
+  int    i = int(u);
+  if ( i >= k ) i = k-1;
+  return ( u - i < _prob[i] ) ? i : _alias[i];
+}
+
+//______________________________________________________________________________
+double PileupSampler::probability(int n) const
+{
+  if ( n < 0 || n >= int(_pmf.size()) ) return 0.;
+  return _pmf[n];
+}
@@ -0,0 +1,107 @@
+//--------------------------------------------------------------------------
+// PythiaMaxiCache
+//
+// PYMAXI results keyed by a hash of the PYTHIA settings
+//
+//------------------------------------------------------------------------
+#include <string.h>
+#include <fstream>
+
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/PythiaMaxiCache.hh"
+
+//______________________________________________________________________________
+unsigned long long PythiaMaxiCache::key(const std::vector<double>& pars)
+{
+  return key(pars.empty() ? 0 : &pars[0], pars.size()*sizeof(double));
+}
+
+//______________________________________________________________________________
+unsigned long long PythiaMaxiCache::key(const void* data, unsigned long nbytes,
+					unsigned long long h)
+{
+  const unsigned char* c = (const unsigned char*) data;
+  for ( unsigned long i=0; i<nbytes; i++ ) {
+    h ^= c[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+//______________________________________________________________________________
+int PythiaMaxiCache::read(const std::string& fileName)
+{
+  _entries.clear();
+  std::ifstream in(fileName.c_str(), std::ios::in | std::ios::binary);
+  if ( !in ) return 0;
+
+  char magic[8];
+  while ( in.read(magic,8) ) {
+    unsigned long long k;
+    int   nsub;
+    long long nrandom;
+    Entry e;
+    if ( strncmp(magic,"PYMAXI01",8) != 0 ) break;
+    in.read((char*) &k      , sizeof(k));
+    in.read((char*) &nsub   , sizeof(nsub));
+    in.read((char*) &nrandom, sizeof(nrandom));
+    in.read((char*) &e.xsec0, sizeof(e.xsec0));
+    if ( !in || nsub < 0 || nsub > 500 ) break;
+    e.nRandom = nrandom;
+    e.isub.resize(nsub);
+    e.xsec.resize(nsub);
+    e.coef.resize(NCOEF*nsub);
+    for ( int i=0; i<nsub; i++ ) {
+      in.read((char*) &e.isub[i], sizeof(int));
+      in.read((char*) &e.xsec[i], sizeof(double));
+      in.read((char*) &e.coef[NCOEF*i], NCOEF*sizeof(double));
+    }
+    if ( !in ) break;
+    _entries[k] = e;
+  }
+  if ( !in.eof() ) {
+    ERRLOG(ELerror,"[PYTHIA_MAXI_CACHE]")
+      << "PythiaMaxiCache: corrupted cache file " << fileName << endmsg;
+    _entries.clear();
+    return -1;
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int PythiaMaxiCache::append(const std::string& fileName, unsigned long long k,
+			    const Entry& e)
+{
+					// one write per record, so that
+					// a crash leaves no partial entry
+  int nsub = e.isub.size();
+  long long nrandom = e.nRandom;
+  std::string rec("PYMAXI01",8);
+  rec.append((const char*) &k      , sizeof(k));
+  rec.append((const char*) &nsub   , sizeof(nsub));
+  rec.append((const char*) &nrandom, sizeof(nrandom));
+  rec.append((const char*) &e.xsec0, sizeof(e.xsec0));
+  for ( int i=0; i<nsub; i++ ) {
+    rec.append((const char*) &e.isub[i], sizeof(int));
+    rec.append((const char*) &e.xsec[i], sizeof(double));
+    rec.append((const char*) &e.coef[NCOEF*i], NCOEF*sizeof(double));
+  }
+
+  std::ofstream out(fileName.c_str(),
+		    std::ios::out | std::ios::binary | std::ios::app);
+  out.write(rec.data(), rec.size());
+  if ( !out ) {
+    ERRLOG(ELerror,"[PYTHIA_MAXI_CACHE]")
+      << "PythiaMaxiCache: can't write " << fileName << endmsg;
+    return -1;
+  }
+  _entries[k] = e;
+  return 0;
+}
+
+//______________________________________________________________________________
+const PythiaMaxiCache::Entry* PythiaMaxiCache::find(unsigned long long k) const
+{
+  std::map<unsigned long long, Entry>::const_iterator i = _entries.find(k);
+  return ( i == _entries.end() ) ? 0 : &i->second;
+}
@@ -27,6 +27,7 @@ PythiaMenu::PythiaMenu( AppModule* target,
   _target    ("target",      target, "PBAR  "),
   _frame     ("frame" ,      target, "CMS" ),
   _pygiveFile("pygiveFile",  target, "" ),
+  _maxiCacheFile("maxiCacheFile", target, "" ),
   _pyeditAction("pyeditAction",target, -1, -1),
   _allowBMixing("allowBMixing",target, false),
   _tuneUE("tuneUE",target, 0),
@@ -36,6 +37,8 @@ PythiaMenu::PythiaMenu( AppModule* target,
   _decayFile("decayFile",target,""),
   _decayTableMode("readDecayTableMode",target, 2, 2, 3),
   _selectPdgCode("selectPdgCode",target, 0),
+  _rehadronizeTries("rehadronizeTries",target, 0),
+  _rehadronizeWeight("rehadronizeWeight",target, false),
   _expWeight("exponentialWeight",target, 0., -30., 30),
   _weightParam("weightParameter",target, 1, 1, 4),
 
@@ -117,6 +120,10 @@ void PythiaMenu::InitPythiaMenu() {
 
   _selectPdgCode.addDescription(
 		"      \t\t\t set Pdg code of particle to be selected at generation time, default 0(nothing)");
+  _rehadronizeTries.addDescription(
+		"      \t\t\tPythiaModule: with selectPdgCode, rerun only fragmentation and decays\n\t\t\t(PYEXEC) of the same parton level event up to N times before\n\t\t\tgenerating a new hard process, default 0 (new hard process each time)");
+  _rehadronizeWeight.addDescription(
+		"      \t\t\tPythiaModule: always do the rehadronizeTries hadronisations, keep the\n\t\t\tfirst selected one and weight the event by (selected tries)/N, so the\n\t\t\tweighted sample is unbiased (default false: stop at the first one)");
   
   _msel.addDescription(
 		       "      \t\t\tMain Process selection for the generation");  
@@ -146,6 +153,8 @@ void PythiaMenu::InitPythiaMenu() {
 			    "      \t\t\tMode for reading decay table, 2 or 3");
   _pygiveFile.addDescription(
 			    "      \t\t\tPYGIVE parameters filename");
+  _maxiCacheFile.addDescription(
+			    "      \t\t\tPythiaModule: local cache of the PYINIT cross-section maximisation,\n\t\t\treplayed for identical PYTHIA settings (default none)");
   _pyeditAction.addDescription(
 			    "      \t\t\tPYEDIT action to be performed");
   _expWeight.addDescription(
@@ -169,6 +178,8 @@ void PythiaMenu::InitPythiaMenu() {
   
   commands()->append(&_msel);
   commands()->append(&_selectPdgCode);
+  commands()->append(&_rehadronizeTries);
+  commands()->append(&_rehadronizeWeight);
   commands()->append(&_frame);
   commands()->append(&_win);
   commands()->append(&_target);
@@ -182,6 +193,7 @@ void PythiaMenu::InitPythiaMenu() {
   commands()->append(&_decayTableMode);
   commands()->append(&_decayFile);
   commands()->append(&_pygiveFile);
+  commands()->append(&_maxiCacheFile);
   commands()->append(&_pyeditAction);
   commands()->append(&_expWeight);
   commands()->append(&_weightParam);
@@ -30,7 +30,8 @@ const char* PythiaMinBias::genId="PythiaMinBias";
 PythiaMinBias::PythiaMinBias() : 
   AbsGenModule( PythiaMinBias::genId, 
 		"AC++ Pythia module"),
-  _pythiaMenu( new PythiaMenu( this, 0, "PythiaMenu") )
+  _pythiaMenu( new PythiaMenu( this, 0, "PythiaMenu") ),
+  _library( this )
 {
 
   _initializeTalkTo();
@@ -179,11 +180,20 @@ AppResult PythiaMinBias::genBeginJob() {
   std::cout << " Event list level " 
 	    << _pythiaMenu->eventlistlevel()
 	    << std::endl;
+  if ( _library.open(name()) ) return AppResult::ERROR;
   return AppResult::OK;
 }
 
 int PythiaMinBias::callGenerator(AbsEvent* anEvent) {
     
+  if ( _library.reading() ) {
+    CdfHepevt* hepevt = CdfHepevt::Instance();
+					// errors are logged by the menu
+    _library.overlay(AbsGenModule::absGenEngine,
+		     *hepevt->HepevtPtr(), *hepevt->Hepev4Ptr());
+    return 0;
+  }
+
   Pythia* pythia = Pythia::Instance();
 
   //// cash commons
@@ -218,6 +228,8 @@ int PythiaMinBias::callGenerator(AbsEvent* anEvent) {
  
 void PythiaMinBias::fillHepevt() {
 
+  if ( _library.reading() ) return;
+
   // COPY COMMONS BACK BEFORE RETURN
 
   Pythia* pythia = Pythia::Instance();
@@ -235,6 +247,11 @@ pythia->pypars().pari(17);
 pythia->pypars().pari(10);
 //dt.end
 
+  if ( _library.writing() ) {
+    _library.record( *CdfHepevt::Instance()->HepevtPtr(),
+		     *CdfHepevt::Instance()->Hepev4Ptr() );
+  }
+
 /*
 // DUMP HEPG HERE
 
@@ -272,6 +289,7 @@ AppResult PythiaMinBias::genEndJob() {
   int mstat = _pythiaMenu->statlistlevel();
   cout << "Call PYSTAT at endJob" << endl;
   pythia->Pystat(&mstat);
+  _library.close(std::cout,name());
 
   return AppResult::OK;
 }
@@ -281,6 +299,7 @@ void PythiaMinBias::_initializeTalkTo() {
   _pythiaMenu->initialize("PythiaMenu",this);
   _pythiaMenu->initTitle( " Pythia Menu " );
   commands()->append( _pythiaMenu );
+  commands()->append( &_library );
 }
 
 
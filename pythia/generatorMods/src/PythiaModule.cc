@@ -12,6 +12,8 @@ using std::string;
 // This Class's Header --
 //-----------------------
 #include "generatorMods/PythiaModule.hh"
+#include "generatorMods/PythiaMaxiCache.hh"
+#include "generatorMods/GenRehadronizer.hh"
 #include "pythia_i/Pythia.hh"
 #include "stdhep_i/CdfHepevt.hh"
 
@@ -20,6 +22,10 @@ using std::string;
 //---------------
 #include <iostream>
 #include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
 using std::cout;
 using std::endl;
 using std::setw;
@@ -39,6 +45,216 @@ using std::setw;
 
 const char* PythiaModule::genId="Pythia";
 
+// PYEXEC for the selectPdgCode re-hadronisation
+extern "C" {
+  void pyexec_();
+}
+
+// copy of the lines in use of /PYJETS/; K, P and V are stored column by
+// column, so column j of the n lines in use starts at k(1,j)
+struct PyjetsCopy {
+  int                 n;
+  std::vector<int>    k;
+  std::vector<double> p, v;
+
+  void save() {
+    Pythia* pythia = Pythia::Instance();
+    n = pythia->pyjets().n();
+    k.resize(5*n);
+    p.resize(5*n);
+    v.resize(5*n);
+    if (n == 0) return;
+    for (int j=0; j<5; j++) {
+      memcpy(&k[j*n],&pythia->pyjets().k(1,j+1),n*sizeof(int));
+      memcpy(&p[j*n],&pythia->pyjets().p(1,j+1),n*sizeof(double));
+      memcpy(&v[j*n],&pythia->pyjets().v(1,j+1),n*sizeof(double));
+    }
+  }
+  void restore() const {
+    Pythia* pythia = Pythia::Instance();
+    pythia->pyjets().n() = n;
+    if (n == 0) return;
+    for (int j=0; j<5; j++) {
+      memcpy(&pythia->pyjets().k(1,j+1),&k[j*n],n*sizeof(int));
+      memcpy(&pythia->pyjets().p(1,j+1),&p[j*n],n*sizeof(double));
+      memcpy(&pythia->pyjets().v(1,j+1),&v[j*n],n*sizeof(double));
+    }
+  }
+};
+
+// the GenRehadronizer hooks: PYEVNT (MSTP(111)=0) gives the parton level,
+// PYEXEC hadronises it
+class PythiaRehadronizer : public GenRehadronizer {
+public:
+  PythiaRehadronizer() : code(0), progress(0) {}
+  int         code;                     // selectPdgCode
+  const char* progress;                 // module name if listing progress
+protected:
+  void newPartonLevel() {
+    Pythia::Instance()->Pyevnt();
+    partonLevel.save();
+    if (progress && (nHard()+1)%100 == 0) {
+      std::cout << progress << "::callGenerator generated " << nHard()+1
+		<< " hard processes" << std::endl;
+    }
+  }
+  void restorePartonLevel() { partonLevel.restore(); }
+  bool hadronize() {
+    Pythia* pythia = Pythia::Instance();
+    pyexec_();
+    return pythia->pydat1().mstu(24) == 0 && pythia->findPdgCode(&code);
+  }
+  void saveHadronLevel()    { hadronLevel.save(); }
+  void restoreHadronLevel() { hadronLevel.restore(); }
+private:
+  PyjetsCopy partonLevel;
+  PyjetsCopy hadronLevel;
+};
+
+static PythiaRehadronizer rehadronizer;
+
+// PYMAXI cache hooks.  Binaries linked with -Wl,--wrap=pymaxi_ and
+// -Wl,--wrap=pyr_ (PYTHIA_MAXI_CACHE=1, see link_generatorMods.mk) get
+// their PYINIT call to PYMAXI here: a cached maximisation is replayed
+// (XSEC/COEF restored and the PYR calls of PYMAXI skipped over), otherwise
+// the real PYMAXI runs and what it changed is recorded.  The __real_
+// symbols are weak so that binaries linked without the wraps, which never
+// call these hooks, link as well.
+extern "C" {
+  void   __real_pymaxi_() __attribute__((weak));
+  double __real_pyr_(int*) __attribute__((weak));
+  extern struct {
+    int    ngenpd;
+    int    ngen[3][501];
+    double xsec[3][501];
+  } pyint5_;
+}
+
+static const PythiaMaxiCache::Entry* maxiReplay = 0;
+static PythiaMaxiCache::Entry*       maxiRecord = 0;
+static bool maxiHooked   = false;
+static bool maxiCounting = false;
+static long maxiNRandom  = 0;
+
+extern "C" double __wrap_pyr_(int* idum) {
+  if (maxiCounting) maxiNRandom++;
+  return __real_pyr_(idum);
+}
+
+extern "C" void __wrap_pymaxi_() {
+  const int ncoef = PythiaMaxiCache::NCOEF;
+  Pythia* pythia = Pythia::Instance();
+					// PYR not wrapped: can't count or
+					// skip its calls, just run PYMAXI
+  if (!__real_pyr_ || !__real_pymaxi_) {
+    if (__real_pymaxi_) __real_pymaxi_();
+    return;
+  }
+  maxiHooked = true;
+
+  if (maxiReplay) {
+    const PythiaMaxiCache::Entry& e = *maxiReplay;
+    for (unsigned i=0; i<e.isub.size(); i++) {
+      pyint5_.xsec[0][e.isub[i]] = e.xsec[i];
+      for (int j=1; j<=ncoef; j++) {
+	pythia->pyint2().coef(e.isub[i],j) = e.coef[ncoef*i+j-1];
+      }
+    }
+    pyint5_.xsec[0][0] = e.xsec0;
+    int idum = 0;
+    for (long i=0; i<e.nRandom; i++) __real_pyr_(&idum);
+    return;
+  }
+					// what PYMAXI changes
+  std::vector<double> xsec(pyint5_.xsec[0],pyint5_.xsec[0]+501);
+  std::vector<double> coef(500*ncoef);
+  if (maxiRecord) {
+    for (int i=1; i<=500; i++) {
+      for (int j=1; j<=ncoef; j++) coef[ncoef*(i-1)+j-1] = pythia->pyint2().coef(i,j);
+    }
+  }
+  maxiNRandom  = 0;
+  maxiCounting = true;
+  __real_pymaxi_();
+  maxiCounting = false;
+
+  if (maxiRecord) {
+    PythiaMaxiCache::Entry& e = *maxiRecord;
+    e = PythiaMaxiCache::Entry();
+    e.nRandom = maxiNRandom;
+    e.xsec0   = pyint5_.xsec[0][0];
+    for (int i=1; i<=500; i++) {
+      bool changed = ( pyint5_.xsec[0][i] != xsec[i] );
+      for (int j=1; j<=ncoef && !changed; j++) {
+	changed = ( pythia->pyint2().coef(i,j) != coef[ncoef*(i-1)+j-1] );
+      }
+      if (!changed) continue;
+      e.isub.push_back(i);
+      e.xsec.push_back(pyint5_.xsec[0][i]);
+      for (int j=1; j<=ncoef; j++) e.coef.push_back(pythia->pyint2().coef(i,j));
+    }
+  }
+}
+
+// hash of every PYTHIA setting PYINIT depends on: frame, target, energy,
+// the commons set through PythiaSetCommands and the SUSY spectrum file
+// PYINIT may read
+static unsigned long long pythiaSettingsKey(const PythiaMenu* menu,
+					    const char* slhaFile) {
+  Pythia* pythia = Pythia::Instance();
+  std::vector<double> v;
+  std::string beams = menu->frame() + "/" + menu->getTarget();
+  for (unsigned i=0; i<beams.size(); i++) v.push_back(beams[i]);
+  v.push_back(menu->win());
+  v.push_back(pythia->pysubs().msel());
+
+  int i, j;
+  for (i=1; i<=pythia->pydat1().lenMstu(); i++) v.push_back(pythia->pydat1().mstu(i));
+  for (i=1; i<=pythia->pydat1().lenParu(); i++) v.push_back(pythia->pydat1().paru(i));
+  for (i=1; i<=pythia->pydat1().lenMstj(); i++) v.push_back(pythia->pydat1().mstj(i));
+  for (i=1; i<=pythia->pydat1().lenParj(); i++) v.push_back(pythia->pydat1().parj(i));
+  for (i=1; i<=pythia->pypars().lenMstp(); i++) v.push_back(pythia->pypars().mstp(i));
+  for (i=1; i<=pythia->pypars().lenParp(); i++) v.push_back(pythia->pypars().parp(i));
+  for (i=1; i<=pythia->pysubs().lenMsub(); i++) v.push_back(pythia->pysubs().msub(i));
+  for (i=1; i<=pythia->pysubs().lenCkin(); i++) v.push_back(pythia->pysubs().ckin(i));
+  for (i=1; i<=pythia->pysubs().lenKfin()/2; i++) {
+    v.push_back(pythia->pysubs().kfin(1, i));
+    v.push_back(pythia->pysubs().kfin(2, i));
+    v.push_back(pythia->pysubs().kfin(1,-i));
+    v.push_back(pythia->pysubs().kfin(2,-i));
+  }
+  for (i=1; i<=pythia->pydat2().lenPmas(); i++) {
+    for (j=1; j<=4; j++) v.push_back(pythia->pydat2().pmas(i,j));
+  }
+  for (i=1; i<=pythia->pydat3().lenMdcy(); i++) {
+    for (j=1; j<=3; j++) v.push_back(pythia->pydat3().mdcy(i,j));
+  }
+  for (i=1; i<=pythia->pydat3().lenMdme(); i++) {
+    for (j=1; j<=2; j++) v.push_back(pythia->pydat3().mdme(i,j));
+  }
+  for (i=1; i<=pythia->pydat3().lenBrat(); i++) v.push_back(pythia->pydat3().brat(i));
+  for (i=1; i<=pythia->pydat3().lenKfdp(); i++) {
+    for (j=1; j<=pythia->pydat3().depthKfdp(); j++) v.push_back(pythia->pydat3().kfdp(i,j));
+  }
+  for (i=1; i<=pythia->pyint2().lenIset(); i++) v.push_back(pythia->pyint2().iset(i));
+  for (i=1; i<=pythia->pyint2().lenKfpr(); i++) {
+    for (j=1; j<=pythia->pyint2().depthKfpr(); j++) v.push_back(pythia->pyint2().kfpr(i,j));
+  }
+  for (i=1; i<=pythia->pymssm().lenImss(); i++) v.push_back(pythia->pymssm().imss(i));
+  for (i=1; i<=pythia->pymssm().lenRmss(); i++) v.push_back(pythia->pymssm().rmss(i));
+  for (i=1; i<=pythia->pytcsm().lenItcm(); i++) v.push_back(pythia->pytcsm().itcm(i));
+  for (i=1; i<=pythia->pytcsm().lenRtcm(); i++) v.push_back(pythia->pytcsm().rtcm(i));
+
+  unsigned long long h = PythiaMaxiCache::key(v);
+  std::ifstream slha(slhaFile, std::ios::in | std::ios::binary);
+  if (slha) {
+    std::string bytes((std::istreambuf_iterator<char>(slha)),
+		      std::istreambuf_iterator<char>());
+    h = PythiaMaxiCache::key(bytes.data(),bytes.size(),h);
+  }
+  return h;
+}
+
 //----------------
 // Constructors --
 //----------------
@@ -46,7 +262,14 @@ const char* PythiaModule::genId="Pythia";
 PythiaModule::PythiaModule() : 
   AbsGenModule( PythiaModule::genId, 
 		"AC++ Pythia module"),
-  _pythiaMenu( new PythiaMenu( this, 0, "PythiaMenu") )
+  _pythiaMenu( new PythiaMenu( this, 0, "PythiaMenu") ),
+  _rehadronize(false),
+  _mstp111(1),
+  _rehadWeight(1.),
+  _rehadHard(0),
+  _rehadTries(0),
+  _rehadEvents(0),
+  _rehadSumWeight(0.)
 {
 
   _initializeTalkTo();
@@ -167,6 +390,22 @@ AppResult PythiaModule::genBeginJob() {
 
   int slhalun = 37;
 
+  // PYMAXI cache: replay the maximisation of identical earlier settings
+  std::string maxiFile = _pythiaMenu->maxiCacheFile();
+  PythiaMaxiCache        maxiCache;
+  PythiaMaxiCache::Entry maxiEntry;
+  unsigned long long     maxiKey = 0;
+  if (!maxiFile.empty()) {
+    maxiKey = pythiaSettingsKey(_pythiaMenu,"susyhit_slha.out");
+    if (maxiCache.read(maxiFile) == 0) {
+      maxiReplay = maxiCache.find(maxiKey);
+      maxiRecord = maxiReplay ? 0 : &maxiEntry;
+      maxiHooked = false;
+    }
+    else {
+      maxiFile.clear();
+    }
+  }
 
   std::cout << "Open Decay File: susyhit_slha.out" << std::endl;
   pythia->Opdcay("susyhit_slha.out",&slhalun,"r");
@@ -174,12 +413,56 @@ AppResult PythiaModule::genBeginJob() {
 
   pythia->Pyinit(frame,target,&winval );
 
+  if (!maxiFile.empty()) {
+    std::ostringstream k;
+    k << std::hex << std::setw(16) << std::setfill('0') << maxiKey;
+    if (!maxiHooked) {
+      ERRLOG(ELwarning,"[PYTHIA_MAXI_CACHE]")
+	<< "PythiaModule: PYMAXI/PYR are not wrapped (link with "
+	<< "PYTHIA_MAXI_CACHE=1), maxiCacheFile ignored" << endmsg;
+    }
+    else if (maxiReplay) {
+      ERRLOG(ELsuccess,"[PYTHIA_MAXI_CACHE]")
+	<< "PythiaModule: cross-section maxima " << k.str()
+	<< " read from " << maxiFile << endmsg;
+    }
+    else if (maxiCache.append(maxiFile,maxiKey,maxiEntry) == 0) {
+      ERRLOG(ELsuccess,"[PYTHIA_MAXI_CACHE]")
+	<< "PythiaModule: cross-section maxima " << k.str()
+	<< " saved to " << maxiFile << endmsg;
+    }
+    maxiReplay = 0;
+    maxiRecord = 0;
+  }
+
   std::cout << "Close Decay File: susyhit_slha.out" << std::endl;
   pythia->Cldcay(&slhalun);
   std::cout << "File Closed" << std::endl;
 
   pythia->setEvents(0);
   pythia->setEventListLevel(minlist);
+
+  // selectPdgCode by re-hadronisation: PYEVNT stops at parton level
+  // (MSTP(111)=0) and callGenerator runs PYEXEC itself
+  _rehadronize = false;
+  if (_pythiaMenu->selectPdg()!=0 && _pythiaMenu->rehadronizeTries()>0) {
+    _mstp111 = pythia->pypars().mstp(111);
+    if (_mstp111 == 0) {
+      ERRLOG(ELwarning,"[PYTHIA_REHADRONIZE]")
+	<< "PythiaModule: MSTP(111)=0, no hadronisation to repeat, "
+	<< "rehadronizeTries ignored" << endmsg;
+    }
+    else {
+      pythia->pypars().mstp(111) = 0;
+      _rehadronize = true;
+      ERRLOG(ELsuccess,"[PYTHIA_REHADRONIZE]")
+	<< "PythiaModule: selectPdgCode " << _pythiaMenu->selectPdg()
+	<< " with up to " << _pythiaMenu->rehadronizeTries()
+	<< " hadronisations per hard process"
+	<< (_pythiaMenu->rehadronizeWeight() ? ", weighted" : "")
+	<< endmsg;
+    }
+  }
   
 
   if (!fileName.empty()) {
@@ -218,19 +501,28 @@ int PythiaModule::callGenerator(AbsEvent* anEvent) {
     
   Pythia* pythia = Pythia::Instance();
 
-  // Generate the event
-  pythia->Pyevnt();
   bool eventList = ( pythia->events() >= pythia->FirstListEvent() && 
 		     pythia->events() <= pythia->LastListEvent() );
+  _rehadWeight = 1.;
 
-  if (_pythiaMenu->selectPdg()!=0) {
-    int code = _pythiaMenu->selectPdg();
-    int icount = 0;
-    while(pythia->findPdgCode(&code)==false) {
-      if ( verbose() ) {
-	if (++icount%100==0 && eventList) std::cout << name() << "::callGenerator generated " << icount << std::endl;
+  if (_rehadronize) {
+    rehadronizeSelect(_pythiaMenu->selectPdg(), eventList);
+  }
+  else {
+    // Generate the event
+    pythia->Pyevnt();
+
+    if (_pythiaMenu->selectPdg()!=0) {
+      int code = _pythiaMenu->selectPdg();
+      int icount = 0;
+      while(pythia->findPdgCode(&code)==false) {
+	if ( verbose() ) {
+	  if ((icount+1)%100==0 && eventList) std::cout << name() << "::callGenerator generated " << icount+1 << std::endl;
+	}
+	pythia->Pyevnt();
+	icount++;
       }
-       pythia->Pyevnt();
+      countRetries("selectPdg", icount+1);
     }
   }
 
@@ -265,7 +557,7 @@ void PythiaModule::fillHepevt() {
 pythia->pypars().pari(17);
 
   CdfHepevt::Instance()->Hepev4Ptr()->EVENTWEIGHTLH=
-pythia->pypars().pari(10);
+pythia->pypars().pari(10)*_rehadWeight;
 //dt.end
 
 }
@@ -281,6 +573,21 @@ AppResult PythiaModule::genEndRun(AbsEvent* aRun) {
 
 AppResult PythiaModule::genEndJob() {
   Pythia* pythia = Pythia::Instance();
+  if (_rehadronize) {
+    pythia->pypars().mstp(111) = _mstp111;
+    cout << "PythiaModule: selectPdgCode by re-hadronisation: "
+	 << _rehadEvents << " events from " << _rehadHard
+	 << " hard processes and " << _rehadTries << " PYEXEC calls";
+    if (_rehadEvents > 0) {
+      cout << ", " << double(_rehadTries)/_rehadEvents << " per event";
+    }
+    if (_rehadHard > 0) {
+      cout << endl << "              selected fraction of hard processes "
+	   << (_pythiaMenu->rehadronizeWeight() ? "(sum of weights) " : "")
+	   << _rehadSumWeight/_rehadHard;
+    }
+    cout << endl;
+  }
   int mstat = _pythiaMenu->statlistlevel();
   cout << "Call PYSTAT at endJob" << endl;
   pythia->Pystat(&mstat);
@@ -297,3 +604,21 @@ AppResult PythiaModule::genEndJob() {
 
 
 
+
+//------------------------------------------------------------------------------
+// selectPdgCode by re-hadronisation, see GenRehadronizer: each parton level
+// event is hadronised up to rehadronizeTries times, with rehadronizeWeight
+// all tries are done and the event weight is (selected tries)/tries
+//------------------------------------------------------------------------------
+void PythiaModule::rehadronizeSelect(int code, bool eventList) {
+  rehadronizer.code     = code;
+  rehadronizer.progress = ( verbose() && eventList ) ? name() : 0;
+  _rehadWeight = rehadronizer.select(_pythiaMenu->rehadronizeTries(),
+				     _pythiaMenu->rehadronizeWeight());
+  _rehadHard      += rehadronizer.nHard();
+  _rehadTries     += rehadronizer.nExec();
+  _rehadEvents    += 1;
+  _rehadSumWeight += _rehadWeight;
+  countRetries("selectPdg", rehadronizer.nHard());
+  countRetries("rehadronize", rehadronizer.nExec());
+}
@@ -0,0 +1,146 @@
+//--------------------------------------------------------------------------
+// RunLumiTable
+//
+// run -> integrated luminosity table with cumulative binary search
+//
+//------------------------------------------------------------------------
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "ErrorLogger_i/gERRLOG.hh"
+#include "generatorMods/RunLumiTable.hh"
+
+//______________________________________________________________________________
+int RunLumiTable::read(const std::string& fileName, int runMin, int runMax)
+{
+  _runs.clear();
+  _cumul.clear();
+  std::ifstream in(fileName.c_str(), std::ios::in | std::ios::binary);
+  if ( !in ) {
+    ERRLOG(ELerror,"[GEN_LUMI_TABLE]")
+      << "RunLumiTable: can't open " << fileName << endmsg;
+    return -1;
+  }
+
+  int run;
+  double lumi;
+  char magic[8];
+  in.read(magic,8);
+  if ( in.gcount() == 8 && strncmp(magic,"RUNLUMI1",8) == 0 ) {
+    int nrec = 0, nread = 0;
+    in.read((char*) &nrec, sizeof(nrec));
+    for ( ; nread<nrec; nread++ ) {
+      in.read((char*) &run , sizeof(run));
+      in.read((char*) &lumi, sizeof(lumi));
+      if ( !in ) break;
+      if ( runMin && run < runMin ) continue;
+      if ( runMax && run > runMax ) continue;
+      add(run,lumi);
+    }
+    if ( nread != nrec ) {
+      ERRLOG(ELerror,"[GEN_LUMI_TABLE]")
+	<< "RunLumiTable: truncated binary table " << fileName << endmsg;
+      _runs.clear();
+      _cumul.clear();
+      return -1;
+    }
+  }
+  else {
+    in.clear();
+    in.seekg(0);
+    std::string line;
+    while ( std::getline(in,line) ) {
+      std::string::size_type c = line.find('#');
+      if ( c != std::string::npos ) line.erase(c);
+      std::istringstream is(line);
+      if ( !(is >> run >> lumi) ) continue;
+      if ( runMin && run < runMin ) continue;
+      if ( runMax && run > runMax ) continue;
+      add(run,lumi);
+    }
+  }
+  sort();
+
+  if ( totalLumi() <= 0. ) {
+    ERRLOG(ELerror,"[GEN_LUMI_TABLE]")
+      << "RunLumiTable: no luminosity in " << fileName << endmsg;
+    return -1;
+  }
+  return 0;
+}
+
+//______________________________________________________________________________
+int RunLumiTable::write(const std::string& fileName) const
+{
+  std::ofstream out(fileName.c_str(), std::ios::out | std::ios::binary);
+  if ( !out ) return -1;
+  out.write("RUNLUMI1",8);
+  int nrec = _runs.size();
+  out.write((const char*) &nrec, sizeof(nrec));
+  for ( int i=0; i<nrec; i++ ) {
+    double l = lumi(i);
+    out.write((const char*) &_runs[i], sizeof(int));
+    out.write((const char*) &l, sizeof(l));
+  }
+  return out ? 0 : -1;
+}
+
+//______________________________________________________________________________
+void RunLumiTable::add(int run, double lumi)
+{
+  // _cumul holds the plain luminosities until sort()
+  if ( lumi <= 0. ) return;
+  _runs .push_back(run);
+  _cumul.push_back(lumi);
+}
+
+//______________________________________________________________________________
+void RunLumiTable::sort()
+{
+  std::vector<std::pair<int,double> > rl;
+  rl.reserve(_runs.size());
+  for ( unsigned i=0; i<_runs.size(); i++ ) {
+    rl.push_back(std::make_pair(_runs[i],_cumul[i]));
+  }
+  std::sort(rl.begin(),rl.end());
+					// merge repeated runs and accumulate
+  _runs.clear();
+  _cumul.clear();
+  double sum = 0.;
+  for ( unsigned i=0; i<rl.size(); i++ ) {
+    sum += rl[i].second;
+    if ( !_runs.empty() && _runs.back() == rl[i].first ) {
+      _cumul.back() = sum;
+    }
+    else {
+      _runs .push_back(rl[i].first);
+      _cumul.push_back(sum);
+    }
+  }
+}
+
+//______________________________________________________________________________
+double RunLumiTable::lumi(int i) const
+{
+  return ( i == 0 ) ? _cumul[0] : _cumul[i] - _cumul[i-1];
+}
+
+//______________________________________________________________________________
+int RunLumiTable::find(double u) const
+{
+  if ( _runs.empty() ) return 0;
+  double x = u*_cumul.back();
+  int i = std::upper_bound(_cumul.begin(),_cumul.end(),x) - _cumul.begin();
+  if ( i >= int(_runs.size()) ) i = _runs.size()-1;
+  return _runs[i];
+}
+
+//______________________________________________________________________________
+int RunLumiTable::shoot(HepRandomEngine* engine) const
+{
+  return find(engine->flat());
+}
@@ -26,6 +26,7 @@
 // This Class's Header --
 //-----------------------
 #include "generatorMods/VecherModule.hh"
+#include "generatorMods/HepevtPool.hh"
 #include "herwig_i/Herwig.hh"
 //-------------
 // C Headers --
@@ -347,7 +348,8 @@ void VecherModule::fillHepevt(AbsEvent* event) {
   //hepevt2Hepg(event,next);
   CdfHepevt* hepevt = CdfHepevt::Instance();
   Hepevt* cur;
-  cur = new Hepevt( *hepevt->HepevtPtr(), *hepevt->Hepev4Ptr() );
+  cur = HepevtPool::Instance()->acquire( *hepevt->HepevtPtr(), 
+					   *hepevt->Hepev4Ptr() );
   hepevt->contentHepevt().push_back( cur );
   return;
 }
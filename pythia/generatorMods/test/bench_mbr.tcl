@@ -0,0 +1,39 @@
+# MBR throughput benchmark for cdfGen, run by
+#   cd generatorMods/test; gmake mbrbench
+# or by hand with the environment variables below, e.g.
+#   MBR_PROCESS=100 MBR_KIN_TABLES=0 cdfGen generatorMods/test/bench_mbr.tcl
+#
+# MBR_PROCESS     1=hard core 10=double- 100=single-diffractive 1000=elastic
+# MBR_KIN_TABLES  fire-ball pt/rapidity from tables (1) or per call (0)
+# MBR_NEV         number of events
+# MBR_TIMING_FILE summary file with the events_per_s line
+#
+if [ file exists $env(SRT_PRIVATE_CONTEXT)/TclUtils ] { 
+  source $env(SRT_PRIVATE_CONTEXT)/TclUtils/scripts/getenv.tcl
+} else { 
+  source $env(SRT_PUBLIC_CONTEXT)/TclUtils/scripts/getenv.tcl
+}
+
+set mbrProcess    [ getenv MBR_PROCESS     "1" ]
+set mbrKinTables  [ getenv MBR_KIN_TABLES  "1" ]
+set mbrNev        [ getenv MBR_NEV         "5000" ]
+set mbrTimingFile [ getenv MBR_TIMING_FILE "mbr_timing.txt" ]
+
+path enable AllPath
+module input GenInputManager
+module talk GenInputManager
+  run_number set 151435
+exit
+
+mod enable mbr
+mod talk mbr
+  pbeam      set 980
+  process    set $mbrProcess
+  kin_tables set $mbrKinTables
+  TIMING      set t
+  TIMING_FILE set $mbrTimingFile
+exit
+
+begin -nev $mbrNev
+
+exit
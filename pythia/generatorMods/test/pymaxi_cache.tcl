@@ -0,0 +1,51 @@
+# PythiaModule PYMAXI cache check, run by
+#   cd generatorMods/test; gmake pymaxitest
+# or by hand, e.g.
+#   PYMAXI_CACHE=maxi.bin PYMAXI_EVENTS=ev.gcache cdfGen generatorMods/test/pymaxi_cache.tcl
+#
+# PYMAXI_CACHE   maxiCacheFile ("" = no cache)
+# PYMAXI_EVENTS  GenEventCache file with the generated events
+# PYMAXI_NEV     number of events
+#
+# Generic b-bbar (several subprocesses to maximise) with the default
+# seeds: the events must not depend on whether the maxima were computed,
+# computed and saved, or read from the cache.
+#
+if [ file exists $env(SRT_PRIVATE_CONTEXT)/TclUtils ] { 
+  source $env(SRT_PRIVATE_CONTEXT)/TclUtils/scripts/getenv.tcl
+} else { 
+  source $env(SRT_PUBLIC_CONTEXT)/TclUtils/scripts/getenv.tcl
+}
+
+set maxiCache  [ getenv PYMAXI_CACHE  "" ]
+set eventsFile [ getenv PYMAXI_EVENTS "pymaxi_events.gcache" ]
+set nev        [ getenv PYMAXI_NEV    "200" ]
+
+path enable AllPath
+module input GenInputManager
+module talk GenInputManager
+  run_number set 151435
+exit
+
+module talk GenOutputManager
+  CacheFile set $eventsFile
+exit
+
+mod enable Pythia
+mod talk Pythia
+  PythiaMenu
+    maxiCacheFile set $maxiCache
+    msel          set 0
+    commonMenu
+      set_msub -index=81 -value=1
+      set_msub -index=82 -value=1
+      set_msub -index=28 -value=1
+      set_msub -index=68 -value=1
+      set_ckin -index=3  -value=5.
+    exit
+  exit
+exit
+
+begin -nev $nev
+
+exit
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: benchHepevtPool.cc
+// Purpose: Micro-benchmark of the Hepevt storage used by
+//          AbsGenModule::event(): one "new Hepevt" per sub-event
+//          (old path) against the recycled HepevtPool (new path).
+//          Prints allocations and copied bytes per event.
+//
+//   usage: benchHepevtPool [nevents] [nsub] [nhep]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <list>
+
+#include "stdhep_i/Hepevt.hh"
+#include "generatorMods/HepevtPool.hh"
+
+using std::cout;
+using std::endl;
+
+static void fillCommon(HEPEVT& hep, HEPEV4& hep4, int iev, int nhep)
+{
+  hep.NEVHEP = iev;
+  hep.NHEP   = nhep;
+  for ( int i=0; i<nhep; i++ ) {
+    hep.ISTHEP[i]    = 1;
+    hep.IDHEP [i]    = 211;
+    hep.JMOHEP[i][0] = hep.JMOHEP[i][1] = 0;
+    hep.JDAHEP[i][0] = hep.JDAHEP[i][1] = 0;
+    for ( int k=0; k<4; k++ ) hep.PHEP[i][k] = iev + i + k;
+    hep.PHEP[i][4] = 0.1396;
+    for ( int k=0; k<4; k++ ) hep.VHEP[i][k] = 0.;
+  }
+  hep4.EVENTWEIGHTLH = 1.;
+}
+
+int main(int argc, char* argv[])
+{
+  int nev  = ( argc > 1 ) ? atoi(argv[1]) : 10000;
+  int nsub = ( argc > 2 ) ? atoi(argv[2]) : 10;
+  int nhep = ( argc > 3 ) ? atoi(argv[3]) : 20;
+
+  // the commons are large, keep them off the stack
+  HEPEVT* hep  = new HEPEVT;
+  HEPEV4* hep4 = new HEPEV4;
+  memset(hep , 0, sizeof(HEPEVT));
+  memset(hep4, 0, sizeof(HEPEV4));
+
+  std::list<Hepevt*> content;
+					// old path: new/delete per sub-event
+  double oldBytes = 0.;
+  long   oldAlloc = 0;
+  for ( int iev=0; iev<nev; iev++ ) {
+    for ( int j=0; j<nsub; j++ ) {
+      fillCommon(*hep, *hep4, iev, nhep);
+      content.push_back( new Hepevt(*hep, *hep4) );
+      oldAlloc++;
+      oldBytes += sizeof(HEPEVT) + sizeof(HEPEV4);
+    }
+    for ( std::list<Hepevt*>::iterator i = content.begin();
+	  i != content.end(); ++i ) delete *i;
+    content.clear();
+  }
+					// new path: recycled pool
+  HepevtPool* pool = HepevtPool::Instance();
+  for ( int iev=0; iev<nev; iev++ ) {
+    for ( int j=0; j<nsub; j++ ) {
+      fillCommon(*hep, *hep4, iev, nhep);
+      content.push_back( pool->acquire(*hep, *hep4) );
+    }
+    pool->reclaim(content);
+  }
+
+  // the pool never holds more than one event's worth of sub-events
+  assert( pool->nAllocated() == (size_t) nsub );
+  assert( pool->nFree()      == (size_t) nsub );
+
+  // last recycled object must match the common row by row
+  fillCommon(*hep, *hep4, nev, nhep);
+  Hepevt* last = pool->acquire(*hep, *hep4);
+  assert( last->HepevtPtr()->NHEP == nhep );
+  assert( memcmp(last->HepevtPtr()->PHEP, hep->PHEP,
+		 nhep*sizeof(hep->PHEP[0])) == 0 );
+  content.push_back(last);
+  pool->reclaim(content);
+
+  cout << "benchHepevtPool: " << nev << " events, " << nsub
+       << " sub-events/event, NHEP = " << nhep << endl;
+  cout << "  new Hepevt : " << double(oldAlloc)/nev << " allocations/event, "
+       << oldBytes/nev << " bytes copied/event" << endl;
+  cout << "  HepevtPool : " << double(pool->nAllocated())/nev
+       << " allocations/event, "
+       << pool->bytesCopied()/nev << " bytes copied/event" << endl;
+  pool->print(cout);
+
+  delete hep;
+  delete hep4;
+  return 0;
+}
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: makeBeamlineCache.cc
+// Purpose: Sorts the beamline dump of GenPrimVertModule (BeamlineDumpFile
+//          talk-to, one text line per run) into the binary run -> beamline
+//          file read through the BeamlineCacheFile talk-to.
+//
+//   usage: makeBeamlineCache dump.txt [dump2.txt ...] output.bin
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <vector>
+
+#include "generatorMods/BeamlineCache.hh"
+
+int main(int argc, char* argv[])
+{
+  if ( argc < 3 ) {
+    std::cerr << "usage: " << argv[0] 
+	      << " dump.txt [dump2.txt ...] output.bin" << std::endl;
+    return 1;
+  }
+  std::vector<BeamlineCache::Entry> all, part;
+  for ( int i=1; i<argc-1; i++ ) {
+    if ( BeamlineCache::readText(argv[i], part) ) {
+      std::cerr << argv[0] << ": no beamlines in " << argv[i] << std::endl;
+      return 2;
+    }
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  BeamlineCache::sort(all);
+
+  if ( BeamlineCache::writeFile(argv[argc-1], all) ) {
+    std::cerr << argv[0] << ": can't write " << argv[argc-1] << std::endl;
+    return 3;
+  }
+  std::cout << argv[argc-1] << ": " << all.size() << " runs, "
+	    << all.front().run << " - " << all.back().run << std::endl;
+  return 0;
+}
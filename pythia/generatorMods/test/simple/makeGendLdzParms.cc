@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: makeGendLdzParms.cc
+// Purpose: Converts the text betaStar dL/dz parameter sets
+//          (generatorMods/data/GendLdzParms.txt) into the binary file
+//          GendLdz mmaps (GENDLDZ_PARM_FILE).  New run ranges are added
+//          by appending lines to the text file and rerunning this.
+//
+//   usage: makeGendLdzParms input.txt output.bin
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <vector>
+
+#include "generatorMods/GendLdz.hh"
+
+int main(int argc, char* argv[])
+{
+  if ( argc < 3 ) {
+    std::cerr << "usage: " << argv[0] << " input.txt output.bin" << std::endl;
+    return 1;
+  }
+  std::vector<GendLdz::RunBin> bins;
+  if ( GendLdz::readTextParms(argv[1], bins) ) {
+    std::cerr << argv[0] << ": no parameter sets in " << argv[1] << std::endl;
+    return 2;
+  }
+  if ( GendLdz::writeParmFile(argv[2], bins) ) {
+    std::cerr << argv[0] << ": can't write " << argv[2] << std::endl;
+    return 3;
+  }
+  std::cout << argv[2] << ": " << bins.size() << " run ranges, "
+	    << bins.front().firstRun << " - " << bins.back().firstRun << std::endl;
+  return 0;
+}
@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: makeLesEventIndex.cc
+// Purpose: Writes the <event> byte offset index of a Les Houches event
+//          file, read by LesHouchesModule (EventIndexFile talk-to) to
+//          start at firstEventToRead without reading the events before.
+//          Run it once next to the event file, before splitting the
+//          file over many jobs.
+//
+//   usage: makeLesEventIndex events.lhe [index file]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+
+#include "generatorMods/LesEventIndex.hh"
+
+int main(int argc, char* argv[])
+{
+  if ( argc < 2 ) {
+    std::cerr << "usage: " << argv[0] 
+	      << " events.lhe [index file]" << std::endl;
+    return 1;
+  }
+  std::string index = ( argc > 2 ) ? argv[2] 
+    : LesEventIndex::indexName(argv[1]);
+
+  LesEventIndex table;
+  if ( table.build(argv[1]) ) return 2;
+  if ( table.write(index) ) {
+    std::cerr << argv[0] << ": can't write " << index << std::endl;
+    return 3;
+  }
+  std::cout << index << ": " << table.nEvents() << " events, header "
+	    << table.headerEnd() << " bytes" << std::endl;
+  return 0;
+}
@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: makeRunLumiTable.cc
+// Purpose: Converts a text run -> integrated luminosity list (e.g. a
+//          dump of the run database) into the sorted binary table read
+//          by GenInputManager (LumiTableFile talk-to).
+//
+//   usage: makeRunLumiTable input.txt output.bin [runMin runMax]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <iostream>
+
+#include "generatorMods/RunLumiTable.hh"
+
+int main(int argc, char* argv[])
+{
+  if ( argc < 3 ) {
+    std::cerr << "usage: " << argv[0] 
+	      << " input.txt output.bin [runMin runMax]" << std::endl;
+    return 1;
+  }
+  int runMin = ( argc > 3 ) ? atoi(argv[3]) : 0;
+  int runMax = ( argc > 4 ) ? atoi(argv[4]) : 0;
+
+  RunLumiTable table;
+  if ( table.read(argv[1],runMin,runMax) ) return 2;
+  if ( table.write(argv[2]) ) {
+    std::cerr << argv[0] << ": can't write " << argv[2] << std::endl;
+    return 3;
+  }
+  std::cout << argv[2] << ": " << table.size() << " runs, "
+	    << table.totalLumi() << " total luminosity" << std::endl;
+  return 0;
+}
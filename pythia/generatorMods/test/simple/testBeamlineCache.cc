@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testBeamlineCache.cc
+// Purpose: Checks BeamlineCache: dump text -> sorted binary file, binary
+//          search lookups against the text file, the x/y widths (also
+//          missing in old dumps), the LRU hits and the runs that are not
+//          in the file.
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "generatorMods/BeamlineCache.hh"
+
+using std::cout;
+using std::endl;
+
+int main()
+{
+  const char* text = "testBeamlineCache.txt";
+  const char* bin  = "testBeamlineCache.bin";
+  const int   nrun = 3000;
+					// dump order is not run order, run
+					// 1000 is dumped twice, odd runs only
+  FILE* f = fopen(text, "w");
+  for ( int i=0; i<nrun; i++ ) {
+    BeamlineCache::Entry e;
+    e.run    = 138001 + 2*((i*1237) % nrun);
+    e.source = ( i%5 ) ? BeamlineCache::SVX : BeamlineCache::COT;
+    e.x      = 1.e-3*(e.run%97);
+    e.y      = -1.e-3*(e.run%89);
+    e.z      = 0.1*(e.run%7);
+    e.dxdz   = 1.e-5*(e.run%13);
+    e.dydz   = -1.e-5*(e.run%11);
+    e.sigmaZ = 28. + 0.001*(e.run%1000);
+    e.sigmaX = ( i%3 ) ? 25.e-4 + 1.e-6*(e.run%17) : 0.;
+    e.sigmaY = ( i%3 ) ? 26.e-4 - 1.e-6*(e.run%19) : 0.;
+    BeamlineCache::writeText(f, e);
+  }
+  BeamlineCache::Entry dup = { 138001 + 2*1000, BeamlineCache::COT,
+			       0.5, 0.5, 0.5, 0., 0., 99., 1.e-3, 2.e-3 };
+  BeamlineCache::writeText(f, dup);
+					// an old dump line without widths
+  fprintf(f, "%d 1 0.1 0.2 0.3 0 0 77\n", 138001 + 2*1001);
+  fclose(f);
+
+  std::vector<BeamlineCache::Entry> v;
+  assert( BeamlineCache::readText(text, v) == 0 );
+  assert( int(v.size()) == nrun );
+  assert( BeamlineCache::writeFile(bin, v) == 0 );
+
+  BeamlineCache fromText, fromBin;
+  assert( fromText.open(text) == 0 && fromBin.open(bin) == 0 );
+  assert( fromBin.size() == nrun );
+
+  for ( int run=137990; run<138001+2*nrun+10; run++ ) {
+    BeamlineCache::Entry a, b;
+    bool expected = ( run >= 138001 && run < 138001+2*nrun && run%2 == 1 );
+    bool inText = ( fromText.find(run, a) == 0 );
+    bool inBin  = ( fromBin .find(run, b) == 0 );
+    assert( inText == expected && inBin == expected );
+    if ( !inBin ) continue;
+    assert( b.run == run && a.source == b.source );
+    assert( fabs(a.x - b.x) < 1.e-9 && fabs(a.sigmaZ - b.sigmaZ) < 1.e-6 );
+    assert( fabs(a.sigmaX - b.sigmaX) < 1.e-12 &&
+	    fabs(a.sigmaY - b.sigmaY) < 1.e-12 );
+  }
+  BeamlineCache::Entry e;
+  assert( fromBin.find(dup.run, e) == 0 && e.sigmaZ == 99. &&
+	  e.sigmaX == 1.e-3 && e.sigmaY == 2.e-3 );
+  assert( fromBin.find(138001 + 2*1001, e) == 0 && e.sigmaZ == 77. &&
+	  e.sigmaX == 0. && e.sigmaY == 0. );
+					// a copy, not a pointer into the LRU
+  for ( int r=0; r<2*BeamlineCache::LRUSIZE; r++ ) {
+    BeamlineCache::Entry other;
+    fromBin.find(138001 + 4*r, other);
+  }
+  assert( e.run == 138001 + 2*1001 && e.sigmaZ == 77. );
+					// binary search cost, then LRU hits
+  long reads = fromBin.nFileReads();
+  for ( int k=0; k<10; k++ ) {
+    for ( int r=0; r<BeamlineCache::LRUSIZE; r++ ) {
+      assert( fromBin.find(138001 + 2*r, e) == 0 );
+    }
+  }
+  assert( fromBin.nFileReads() - reads <= BeamlineCache::LRUSIZE*13 );
+  assert( fromBin.nLruHits() >= 9*BeamlineCache::LRUSIZE );
+
+					// a truncated file is refused
+  f = fopen(bin, "r+");
+  fseek(f, 8, SEEK_SET);
+  int bad = nrun + 1;
+  fwrite(&bad, sizeof(int), 1, f);
+  fclose(f);
+  BeamlineCache truncated;
+  assert( truncated.open(bin) != 0 );
+
+  remove(text);
+  remove(bin);
+  cout << "testBeamlineCache: OK, " << fromBin.nLookups() << " lookups, "
+       << fromBin.nLruHits() << " LRU hits, " << fromBin.nFileReads()
+       << " record reads" << endl;
+  return 0;
+}
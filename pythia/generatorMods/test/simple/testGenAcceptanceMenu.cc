@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenAcceptanceMenu.cc
+// Purpose: Checks the bookkeeping of the HerwigModule parton level veto
+//          on the saved HERWIG records of herwigRecordSample.txt (the
+//          first has an electron, the other two don't): the retry loop
+//          of HerwigModule::callGenerator is replayed with and without
+//          maxTries, and tries, accepted and forced events and the
+//          efficiency are compared with the expected counts.
+//
+//   usage: testGenAcceptanceMenu [sample file]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "generatorMods/GenAcceptanceMenu.hh"
+
+using std::cout;
+using std::endl;
+
+static std::vector<HEPEVT> records;
+
+static void readRecords(const char* file)
+{
+  std::ifstream in(file);
+  assert(in);
+  std::string line;
+  while ( std::getline(in,line) ) {
+    if ( line.empty() || line[0] == '#' ) continue;
+    records.push_back(HEPEVT());
+    HEPEVT& hep = records.back();
+    std::istringstream head(line);
+    std::string key;
+    head >> key >> hep.NHEP;
+    assert(key == "event" && hep.NHEP > 0 && hep.NHEP <= NMXHEP);
+    for ( int i=0; i<hep.NHEP; i++ ) {
+      in >> hep.ISTHEP[i] >> hep.IDHEP[i]
+	 >> hep.JMOHEP[i][0] >> hep.JMOHEP[i][1]
+	 >> hep.JDAHEP[i][0] >> hep.JDAHEP[i][1];
+      for ( int k=0; k<5; k++ ) in >> hep.PHEP[i][k];
+      assert(in);
+    }
+    std::getline(in,line);
+  }
+}
+
+					// HerwigModule::callGenerator: showers
+					// the records in turn from *next until
+					// one is kept, returns the vetoes
+static int generate(GenAcceptanceMenu& menu, int& next, long& vetoes)
+{
+  int nvetoed = 0;
+  while ( true ) {
+    const HEPEVT& hep = records[next++ % records.size()];
+    if ( menu.decide(hep,nvetoed) != GenAcceptanceMenu::REJECTED ) break;
+    ++vetoes;
+    ++nvetoed;
+  }
+  return nvetoed;
+}
+
+int main(int argc, char* argv[])
+{
+  readRecords( argc > 1 ? argv[1] 
+	       : "generatorMods/test/simple/herwigRecordSample.txt" );
+  assert(records.size() == 3);
+
+  GenAcceptanceMenu off;
+  assert(off.decide(records[1],0) == GenAcceptanceMenu::ACCEPTED);
+  assert(off.nTries() == 0 && off.nAccepted() == 0);
+
+					// an electron: only the first record
+  GenAcceptanceMenu menu;
+  menu.setEnabled(true);
+  menu.setRequirePdg(11);
+  int  next   = 1;
+  long vetoes = 0;
+  for ( int i=0; i<4; i++ ) assert(generate(menu,next,vetoes) == 2);
+  assert(menu.nTries() == 12 && menu.nAccepted() == 4);
+  assert(menu.nForced() == 0 && vetoes == 8);
+  assert(std::fabs(menu.efficiency()-1./3.) < 1.e-12);
+
+					// maxTries 2: from record 1 on every
+					// second try is kept anyway
+  GenAcceptanceMenu limited;
+  limited.setEnabled(true);
+  limited.setRequirePdg(11);
+  limited.setMaxTries(2);
+  next = 1;
+  vetoes = 0;
+  assert(generate(limited,next,vetoes) == 1);	// 1 vetoed, 2 forced
+  assert(generate(limited,next,vetoes) == 0);	// 0 accepted
+  assert(generate(limited,next,vetoes) == 1);	// 1 vetoed, 2 forced
+  assert(limited.nTries() == 5 && limited.nAccepted() == 1);
+  assert(limited.nForced() == 2 && vetoes == 2);
+					// forced events are kept, but the
+					// efficiency is that of the cuts
+  assert(limited.nAccepted()+limited.nForced() == limited.nTries()-vetoes);
+  assert(std::fabs(limited.efficiency()-1./5.) < 1.e-12);
+  limited.print(cout,"testGenAcceptanceMenu");
+
+  cout << "testGenAcceptanceMenu: OK" << endl;
+  return 0;
+}
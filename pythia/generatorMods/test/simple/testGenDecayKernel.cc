@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenDecayKernel.cc
+// Purpose: Regression test of GenDecayKernel::boost against a scalar
+//          copy of MinBiasModule::add_lorentz_boost:
+//          - identical numbers, momentum by momentum
+//          - a particle at rest goes to -m*gamma*beta, E = m*gamma
+//          - invariant masses kept, the inverse boost restores p
+//          - only the requested range is boosted
+//
+//   usage: testGenDecayKernel [nmomenta]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/GenDecayKernel.hh"
+
+using std::cout;
+using std::endl;
+
+					// the old MBR code, one momentum
+static void oldBoost(const double beta[4], const double v1[4], double v2[4])
+{
+  double bp=0;
+  for(int i=0;i<3;i++) bp=bp+beta[i]*v1[i];
+  double bpp=(bp*beta[3]/(beta[3]+1.)-v1[3])*beta[3];
+  v2[0]=v1[0]+beta[0]*bpp;
+  v2[1]=v1[1]+beta[1]*bpp;
+  v2[2]=v1[2]+beta[2]*bpp;
+  v2[3]=beta[3]*(v1[3]-bp);
+}
+
+static double mass(const GenDecayKernel::Momenta& p, int i, int j)
+{
+  double e=p.e[i]+p.e[j], x=p.px[i]+p.px[j];
+  double y=p.py[i]+p.py[j], z=p.pz[i]+p.pz[j];
+  return sqrt(fabs(e*e-x*x-y*y-z*z));
+}
+
+int main(int argc, char* argv[])
+{
+  int n = ( argc > 1 ) ? atoi(argv[1]) : 100000;
+
+  const double M[3] = { 0.139, 0.494, 0.938 };
+  HepJamesRandom engine(4711);
+  GenDecayKernel::Momenta p;
+  p.resize(n);
+  for ( int i=0; i<n; i++ ) {
+    p.px[i] = RandFlat::shoot(&engine,-5.,5.);
+    p.py[i] = RandFlat::shoot(&engine,-5.,5.);
+    p.pz[i] = RandFlat::shoot(&engine,-20.,20.);
+    double m = M[i%3];
+    p.e [i] = sqrt(p.px[i]*p.px[i]+p.py[i]*p.py[i]+p.pz[i]*p.pz[i]+m*m);
+  }
+
+  double beta[4] = { 0.3, -0.2, 0.6, 0. };
+  beta[3] = 1./sqrt(1.-beta[0]*beta[0]-beta[1]*beta[1]-beta[2]*beta[2]);
+  double back[4] = { -beta[0], -beta[1], -beta[2], beta[3] };
+
+					// ---- same numbers as the MBR code
+  GenDecayKernel::Momenta b = p;
+  GenDecayKernel::boost(beta, b, 0, n);
+  for ( int i=0; i<n; i++ ) {
+    double v1[4] = { p.px[i], p.py[i], p.pz[i], p.e[i] }, v2[4];
+    oldBoost(beta, v1, v2);
+    assert( v2[0] == b.px[i] && v2[1] == b.py[i] &&
+	    v2[2] == b.pz[i] && v2[3] == b.e[i] );
+  }
+  cout << "testGenDecayKernel: " << n << " boosts identical to MBR" << endl;
+
+					// ---- particle at rest
+  GenDecayKernel::Momenta r;
+  r.resize(1);
+  r.px[0] = r.py[0] = r.pz[0] = 0.;
+  r.e [0] = M[2];
+  GenDecayKernel::boost(beta, r, 0, 1);
+  assert( fabs(r.px[0]+M[2]*beta[3]*beta[0]) < 1.e-12 );
+  assert( fabs(r.py[0]+M[2]*beta[3]*beta[1]) < 1.e-12 );
+  assert( fabs(r.pz[0]+M[2]*beta[3]*beta[2]) < 1.e-12 );
+  assert( fabs(r.e [0]-M[2]*beta[3]) < 1.e-12 );
+  cout << "testGenDecayKernel: particle at rest OK" << endl;
+
+					// ---- masses, inverse boost
+  for ( int i=0; i+1<n; i++ ) {
+    double mb = sqrt(fabs(b.e[i]*b.e[i]-b.px[i]*b.px[i]-
+			  b.py[i]*b.py[i]-b.pz[i]*b.pz[i]));
+    assert( fabs(mb-M[i%3]) < 1.e-6 );
+    assert( fabs(mass(b,i,i+1)-mass(p,i,i+1)) < 1.e-9 );
+  }
+  GenDecayKernel::boost(back, b, 0, n);
+  for ( int i=0; i<n; i++ ) {
+    assert( fabs(b.px[i]-p.px[i]) < 1.e-9 && fabs(b.py[i]-p.py[i]) < 1.e-9 &&
+	    fabs(b.pz[i]-p.pz[i]) < 1.e-9 && fabs(b.e [i]-p.e [i]) < 1.e-9 );
+  }
+  cout << "testGenDecayKernel: masses kept, inverse boost restores p" << endl;
+
+					// ---- range
+  if ( n >= 30 ) {
+    GenDecayKernel::Momenta s = p;
+    GenDecayKernel::boost(beta, s, 10, 10);
+    for ( int i=0; i<30; i++ ) {
+      bool in = ( i >= 10 && i < 20 );
+      assert( (s.e[i] == p.e[i]) != in && (s.pz[i] == p.pz[i]) != in );
+    }
+    cout << "testGenDecayKernel: range [10,20) only" << endl;
+  }
+
+  cout << "testGenDecayKernel: OK" << endl;
+  return 0;
+}
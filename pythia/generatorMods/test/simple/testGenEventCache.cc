@@ -0,0 +1,291 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenEventCache.cc
+// Purpose: Round trip of the GenOutputManager event cache: events with
+//          0 to several interactions (up to NMXHEP rows), vertices and
+//          LRIH run/event numbers are written by GenEventCacheWriter and read back, in order
+//          and by index, with and without the trailer index, and
+//          records with corrupt lengths, compressed data, interaction
+//          or row counts are rejected without touching the commons.
+//
+//   usage: testGenEventCache [nevents]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "generatorMods/GenEventCache.hh"
+
+using std::cout;
+using std::endl;
+
+static HEPEVT hep, back;
+static HEPEV4 hep4, back4;
+
+					// interaction k of event i
+static void fill(int i, int k)
+{
+  memset(&hep, 0, sizeof(hep));
+  memset(&hep4, 0, sizeof(hep4));
+  hep.NHEP   = ( i == 7 && k == 0 ) ? NMXHEP : (i*13 + k*7) % 300;
+  hep.NEVHEP = 1000*i + k;
+  hep4.EVENTWEIGHTLH = 0.5*i + k;
+  hep4.ALPHAQCDLH    = 0.118;
+  hep4.SCALELH[5]    = 10.*k + i;
+  hep4.IDRUPLH       = 661 + k;
+  for ( int j=0; j<hep.NHEP; j++ ) {
+    hep.ISTHEP[j]    = 1 + j%3;
+    hep.IDHEP[j]     = j%2 ? 211 : -13;
+    hep.JMOHEP[j][0] = j;
+    hep.JDAHEP[j][1] = j+i;
+    for ( int m=0; m<5; m++ ) hep.PHEP[j][m] = 0.25*(i+j+k+m);
+    for ( int m=0; m<4; m++ ) hep.VHEP[j][m] = 1.e-3*(j-m);
+    hep4.SPINLH[j][2]       = j%2 ? 0.5 : -0.5;
+    hep4.ICOLORFLOWLH[j][0] = 500 + j;
+  }
+}
+
+static int nInteractions(int i) { return i%4; }
+static int nVertices    (int i) { return i%3 ? nInteractions(i) : 0; }
+static int run          (int i) { return 150000 + i/7; }
+
+static void vertex(int i, int v, double xyzt[4])
+{
+  xyzt[0] = 0.01*v;
+  xyzt[1] = -0.02*i;
+  xyzt[2] = 3.*v - i;
+  xyzt[3] = 1.e-9*(i+v);
+}
+
+					// rows beyond NHEP are not compared
+static void compare(int i, int k)
+{
+  fill(i,k);
+  assert(back.NHEP == hep.NHEP && back.NEVHEP == hep.NEVHEP);
+  assert(back4.EVENTWEIGHTLH == hep4.EVENTWEIGHTLH);
+  assert(back4.ALPHAQCDLH == hep4.ALPHAQCDLH);
+  assert(back4.SCALELH[5] == hep4.SCALELH[5]);
+  assert(back4.IDRUPLH == hep4.IDRUPLH);
+  int n = hep.NHEP;
+  assert(!memcmp(back.ISTHEP, hep.ISTHEP, n*sizeof(hep.ISTHEP[0])));
+  assert(!memcmp(back.IDHEP , hep.IDHEP , n*sizeof(hep.IDHEP [0])));
+  assert(!memcmp(back.JMOHEP, hep.JMOHEP, n*sizeof(hep.JMOHEP[0])));
+  assert(!memcmp(back.JDAHEP, hep.JDAHEP, n*sizeof(hep.JDAHEP[0])));
+  assert(!memcmp(back.PHEP  , hep.PHEP  , n*sizeof(hep.PHEP  [0])));
+  assert(!memcmp(back.VHEP  , hep.VHEP  , n*sizeof(hep.VHEP  [0])));
+  assert(!memcmp(back4.SPINLH, hep4.SPINLH, n*sizeof(hep4.SPINLH[0])));
+  assert(!memcmp(back4.ICOLORFLOWLH, hep4.ICOLORFLOWLH,
+		 n*sizeof(hep4.ICOLORFLOWLH[0])));
+}
+
+static void check(GenEventCacheReader& r, int i)
+{
+  assert(r.run() == run(i) && r.event() == i+1);
+  assert(r.nInteractions() == nInteractions(i));
+  assert(r.nVertices() == nVertices(i));
+  for ( int k=0; k<r.nInteractions(); k++ ) {
+    r.fillInteraction(k, back, back4);
+    compare(i,k);
+  }
+  for ( int v=0; v<r.nVertices(); v++ ) {
+    double a[4], b[4];
+    r.vertex(v, a);
+    vertex(i, v, b);
+    for ( int m=0; m<4; m++ ) assert(a[m] == b[m]);
+  }
+}
+
+static std::string slurp(const char* name)
+{
+  std::string s;
+  FILE* f = fopen(name, "rb");
+  assert(f);
+  char buf[65536];
+  size_t n;
+  while ( (n = fread(buf, 1, sizeof(buf), f)) > 0 ) s.append(buf, n);
+  fclose(f);
+  return s;
+}
+
+					// a record of the given raw content
+static std::string record(const std::vector<char>& raw, bool spoil = false)
+{
+  uLongf zlen = compressBound(raw.size());
+  std::vector<unsigned char> z(zlen);
+  assert(compress2(&z[0], &zlen, (const Bytef*) &raw[0], raw.size(), 6)
+	 == Z_OK);
+  if ( spoil ) z[zlen/2] ^= 0x5a;
+  unsigned int lengths[2] = { (unsigned int) zlen, (unsigned int) raw.size() };
+  std::string s((const char*) lengths, sizeof(lengths));
+  s.append((const char*) &z[0], zlen);
+  return s;
+}
+
+static void append(std::vector<char>& raw, const void* p, size_t n)
+{
+  raw.insert(raw.end(), (const char*) p, (const char*) p + n);
+}
+
+int main(int argc, char* argv[])
+{
+  int nev = ( argc > 1 ) ? atoi(argv[1]) : 50;
+  if ( nev < 10 ) nev = 10;
+  const char* file = "testGenEventCache.dat";
+  const char* bad  = "testGenEventCache.bad";
+
+  GenEventCacheWriter w;
+  assert(w.open(file, 6) == 0);
+  for ( int i=0; i<nev; i++ ) {
+    assert(!w.pending());
+    for ( int k=0; k<nInteractions(i); k++ ) {
+      fill(i,k);
+      w.addInteraction(hep, hep4);
+    }
+    std::vector<double> v(4*nVertices(i));
+    for ( int j=0; j<nVertices(i); j++ ) vertex(i, j, &v[4*j]);
+    if ( !v.empty() ) w.setVertices(nVertices(i), &v[0]);
+    w.setRunEvent(run(i), i+1);
+    assert(w.pending() == (nInteractions(i) > 0 || nVertices(i) > 0));
+    assert(w.writeEvent() == 0);
+  }
+  assert(w.nEvents() == nev && w.close() == 0);
+
+					// in order, then by index
+  GenEventCacheReader r;
+  assert(r.open(file) == 0 && r.nEvents() == nev);
+  for ( int i=0; i<nev; i++ ) {
+    assert(!r.atEnd() && r.readNext() == 0);
+    check(r,i);
+  }
+  assert(r.atEnd() && r.readNext() != 0);
+  for ( int i=nev-1; i>=0; i -= 3 ) {
+    assert(r.readEvent(i) == 0 && r.next() == i+1);
+    check(r,i);
+  }
+  r.seek(5);
+  assert(r.readNext() == 0);
+  check(r,5);
+  r.fillInteraction(-1, back, back4);
+  assert(back.NHEP == 0);
+
+					// killed job: no trailer, the last
+					// record cut short
+  std::string all = slurp(file);
+  const long headerSize = 8 + 3*sizeof(int);
+  long long indexOffset;
+  memcpy(&indexOffset, &all[all.size()-8-sizeof(indexOffset)],
+	 sizeof(indexOffset));
+  {
+    FILE* f = fopen(bad, "wb");
+    fwrite(all.data(), 1, indexOffset-3, f);
+    fclose(f);
+  }
+  assert(r.open(bad) == 0 && r.nEvents() == nev-1);
+  for ( int i=0; i<nev-1; i++ ) {
+    assert(r.readNext() == 0);
+    check(r,i);
+  }
+
+					// broken records between good ones
+  std::string header = all.substr(0, headerSize);
+  std::string good;
+  {
+    std::vector<char> raw;
+    int head[4] = { 0, 0, 1, 0 };
+    append(raw, head, sizeof(head));
+    fill(3,0);
+    int n = hep.NHEP;
+    append(raw, &n, sizeof(n));
+    append(raw, &hep.NEVHEP, sizeof(hep.NEVHEP));
+    append(raw, &hep4.EVENTWEIGHTLH, sizeof(hep4.EVENTWEIGHTLH));
+    append(raw, &hep4.ALPHAQEDLH, sizeof(hep4.ALPHAQEDLH));
+    append(raw, &hep4.ALPHAQCDLH, sizeof(hep4.ALPHAQCDLH));
+    append(raw, hep4.SCALELH, sizeof(hep4.SCALELH));
+    append(raw, &hep4.IDRUPLH, sizeof(hep4.IDRUPLH));
+    size_t rows = raw.size();
+    append(raw, hep.ISTHEP, n*sizeof(hep.ISTHEP[0]));
+    append(raw, hep.IDHEP , n*sizeof(hep.IDHEP [0]));
+    append(raw, hep.JMOHEP, n*sizeof(hep.JMOHEP[0]));
+    append(raw, hep.JDAHEP, n*sizeof(hep.JDAHEP[0]));
+    append(raw, hep.PHEP  , n*sizeof(hep.PHEP  [0]));
+    append(raw, hep.VHEP  , n*sizeof(hep.VHEP  [0]));
+    append(raw, hep4.SPINLH, n*sizeof(hep4.SPINLH[0]));
+    append(raw, hep4.ICOLORFLOWLH, n*sizeof(hep4.ICOLORFLOWLH[0]));
+    good = record(raw);
+
+    std::string file2 = header + good;
+    std::vector<char> x;
+					// NHEP above NMXHEP
+    x = raw;
+    int big = NMXHEP+1;
+    memcpy(&x[4*sizeof(int)], &big, sizeof(big));
+    file2 += record(x) + good;
+					// negative NHEP
+    int neg = -1;
+    memcpy(&x[4*sizeof(int)], &neg, sizeof(neg));
+    file2 += record(x) + good;
+					// more interactions than data
+    x = raw;
+    head[2] = 2;
+    memcpy(&x[0], head, sizeof(head));
+    file2 += record(x) + good;
+					// negative interaction count
+    head[2] = -3;
+    memcpy(&x[0], head, sizeof(head));
+    file2 += record(x) + good;
+					// vertices missing / left over
+    x = raw;
+    head[2] = 1;
+    head[3] = 1;
+    memcpy(&x[0], head, sizeof(head));
+    file2 += record(x) + good;
+    x = raw;
+    x.push_back(0);
+    file2 += record(x) + good;
+					// rows cut short
+    x.assign(raw.begin(), raw.begin() + rows + 8);
+    file2 += record(x) + good;
+					// shorter than the event head
+    x.assign(raw.begin(), raw.begin() + 13);
+    file2 += record(x) + good;
+					// bad compressed data, raw length
+    file2 += record(raw, true) + good;
+    std::string wrong = record(raw);
+    unsigned int huge = 0xfffffff0u;
+    memcpy(&wrong[sizeof(unsigned int)], &huge, sizeof(huge));
+    file2 += wrong + good;
+
+    FILE* f = fopen(bad, "wb");
+    fwrite(file2.data(), 1, file2.size(), f);
+    fclose(f);
+  }
+  assert(r.open(bad) == 0 && r.nEvents() == 21);
+  int nGood = 0;
+  while ( !r.atEnd() ) {
+    long i = r.next();
+    memset(&back, 0xff, sizeof(back.NEVHEP) + sizeof(back.NHEP));
+    if ( r.readNext() ) {
+      assert(i%2 == 1 && r.nInteractions() == 0 && r.nVertices() == 0 &&
+	     r.run() == 0);
+      continue;
+    }
+    assert(i%2 == 0);
+    assert(r.nInteractions() == 1 && r.nVertices() == 0 && r.run() == 0);
+    r.fillInteraction(0, back, back4);
+    compare(3,0);
+    nGood++;
+  }
+  assert(nGood == 11);
+
+  remove(file);
+  remove(bad);
+  cout << "testGenEventCache: " << nev << " events OK" << endl;
+  return 0;
+}
@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenFakeRecipes.cc
+// Purpose: Test of the MixFakeEv particle recipes (GenFakeRecipes):
+//          - fixed and Poisson multiplicities
+//          - gaussian (eta,phi) cone widths around the event axis
+//          - PT and ETA from 1D and 2D GenHistSampler files, the
+//            generate parameters when there is no file
+//          - truncation at NMXHEP
+//          - the /HEPEVT/ block: ISTHEP 1, IDHEP, JMOHEP, JDAHEP and
+//            VHEP zeroed, PHEP consistent with PT, ETA, PHI and mass
+//
+//   usage: testGenFakeRecipes [nevents]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/GenFakeRecipes.hh"
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+static HEPEVT hep;
+
+					// the generate parameters: flat PT,
+					// a fixed or flat polar angle, phi
+class TestKinematics : public GenFakeRecipes::Kinematics {
+public:
+  TestKinematics(HepRandomEngine* e) : engine(e), pt(true), eta(true),
+    polarMin(-1.), polarMax(1.), phiValue(-1.), nMomentum(0) {}
+  bool usePt() const { return pt; }
+  void momentum(int n, double* p) {
+    nMomentum += n;
+    RandFlat::shootArray(engine, n, p, 1., 100.);
+  }
+  void polar(int n, double* v) {
+    RandFlat::shootArray(engine, n, v, polarMin, polarMax);
+  }
+  void toEta(int n, double* v) {
+    if ( eta ) return;
+    for ( int i=0; i<n; i++ ) v[i] = -log(tan(0.5*M_PI/180.*v[i]));
+  }
+  void phi(int n, double* v) {
+    if ( phiValue >= 0. ) {
+      for ( int i=0; i<n; i++ ) v[i] = phiValue;
+    }
+    else {
+      RandFlat::shootArray(engine, n, v, 0., 2.*M_PI);
+    }
+  }
+  HepRandomEngine* engine;
+  bool   pt, eta;
+  double polarMin, polarMax, phiValue;
+  long   nMomentum;
+};
+
+static double ptOf (int i) { return hypot(hep.PHEP[i][0], hep.PHEP[i][1]); }
+static double pOf  (int i) { return hypot(ptOf(i), hep.PHEP[i][2]); }
+static double etaOf(int i) { return asinh(hep.PHEP[i][2]/ptOf(i)); }
+static double phiOf(int i) { return atan2(hep.PHEP[i][1], hep.PHEP[i][0]); }
+
+					// garbage in every row, so that the
+					// block copy has to overwrite it
+static void spoil() { memset(&hep, 0x5a, sizeof(hep)); }
+
+					// the /HEPEVT/ block of one recipe
+static void checkBlock(int first, int n, int id, double mass)
+{
+  for ( int i=first; i<first+n; i++ ) {
+    assert( hep.ISTHEP[i] == 1 && hep.IDHEP[i] == id );
+    assert( hep.JMOHEP[i][0] == 0 && hep.JMOHEP[i][1] == 0 );
+    assert( hep.JDAHEP[i][0] == 0 && hep.JDAHEP[i][1] == 0 );
+    for ( int m=0; m<4; m++ ) assert( hep.VHEP[i][m] == 0. );
+    assert( hep.PHEP[i][4] == mass );
+    double p = pOf(i);
+    double e = sqrt(p*p + mass*mass);
+    assert( fabs(hep.PHEP[i][3] - e) < 1.e-9*e );
+  }
+}
+
+static void writeFile(const char* name, const char* text)
+{
+  FILE* f = fopen(name, "w");
+  assert(f);
+  fputs(text, f);
+  fclose(f);
+}
+
+int main(int argc, char* argv[])
+{
+  int nev = ( argc > 1 ) ? atoi(argv[1]) : 20000;
+  HepJamesRandom engine(4711);
+  TestKinematics kin(&engine);
+  const double MPI = 0.13957, MK = 0.49368;
+
+					// ---- bad recipes are refused
+  {
+    GenFakeRecipes r;
+    assert( r.add(8, -1., 0, 0., "") != 0 );
+    assert( r.add(8,  1., 0, -.1, "") != 0 );
+    assert( r.empty() );
+  }
+
+					// ---- fixed and Poisson multiplicity,
+					// block layout, parameters without
+					// a histogram
+  {
+    GenFakeRecipes r;
+    assert( r.add(8, 3.5, 0, 0., 0) == 0 );
+    assert( r.add(10, 4.2, 1, 0., "") == 0 );
+    r.recipe(0).pdgId = 211;  r.recipe(0).mass = MPI;
+    r.recipe(1).pdgId = 321;  r.recipe(1).mass = MK;
+    kin.polarMin = -1.;  kin.polarMax = 1.;
+    double sum = 0., sum2 = 0.;
+    long   nFirst = 0;
+    for ( int iev=0; iev<nev; iev++ ) {
+      spoil();
+      assert( r.generate(&engine, kin, hep) == 0 );
+      assert( hep.NHEP >= 4 );
+      int nk = hep.NHEP - 4;
+      sum  += nk;
+      sum2 += double(nk)*nk;
+      nFirst += 4;
+      checkBlock(0, 4, 211, MPI);
+      checkBlock(4, nk, 321, MK);
+      for ( int i=0; i<hep.NHEP; i++ ) {
+	double pt = ptOf(i);
+	assert( pt > 1.-1.e-6 && pt < 100.+1.e-6 );
+	assert( fabs(etaOf(i)) < 1.+1.e-9 );
+      }
+    }
+					// every particle took its PT from
+					// the parameters
+    assert( kin.nMomentum == nFirst + long(sum) );
+    double mean = sum/nev, var = sum2/nev - mean*mean;
+    cerr << "testGenFakeRecipes: Poisson(4.2) mean " << mean
+	 << " variance " << var << endl;
+    assert( fabs(mean-4.2) < 5.*sqrt(4.2/nev) );
+    assert( fabs(var -4.2) < 0.05*4.2 );
+  }
+
+					// ---- P and THETA (degrees) instead
+					// of PT and ETA
+  {
+    GenFakeRecipes r;
+    r.add(8, 5., 0, 0., "");
+    r.recipe(0).pdgId = -211;  r.recipe(0).mass = MPI;
+    kin.pt = false;
+    kin.eta = false;
+    kin.polarMin = 60.;  kin.polarMax = 120.;
+    for ( int iev=0; iev<1000; iev++ ) {
+      spoil();
+      r.generate(&engine, kin, hep);
+      assert( hep.NHEP == 5 );
+      checkBlock(0, 5, -211, MPI);
+      for ( int i=0; i<5; i++ ) {
+	double p = pOf(i), theta = acos(hep.PHEP[i][2]/p)*180./M_PI;
+	assert( p > 1.-1.e-6 && p < 100.+1.e-6 );
+	assert( theta > 60.-1.e-6 && theta < 120.+1.e-6 );
+      }
+    }
+    kin.pt = true;
+    kin.eta = true;
+  }
+
+					// ---- cone widths: eta and phi
+					// around the axis drawn per event
+  {
+    const double cones[2] = { 0.1, 0.4 };
+    for ( int c=0; c<2; c++ ) {
+      GenFakeRecipes r;
+      r.add(8, 10., 0, cones[c], "");
+      r.recipe(0).pdgId = 211;  r.recipe(0).mass = MPI;
+      kin.polarMin = 0.3;  kin.polarMax = 0.3;
+      kin.phiValue = 1.;
+      double se = 0., se2 = 0., sp = 0., sp2 = 0.;
+      long   n = 0;
+      for ( int iev=0; iev<nev/10; iev++ ) {
+	r.generate(&engine, kin, hep);
+	assert( hep.NHEP == 10 );
+	for ( int i=0; i<10; i++ ) {
+	  double de = etaOf(i) - 0.3, dp = phiOf(i) - 1.;
+	  se += de;  se2 += de*de;
+	  sp += dp;  sp2 += dp*dp;
+	  n++;
+	}
+      }
+      double re = sqrt(se2/n - (se/n)*(se/n));
+      double rp = sqrt(sp2/n - (sp/n)*(sp/n));
+      cerr << "testGenFakeRecipes: cone " << cones[c] << " rms eta " << re
+	   << " phi " << rp << endl;
+      assert( fabs(se/n) < 5.*cones[c]/sqrt(double(n)) );
+      assert( fabs(re-cones[c]) < 0.03*cones[c] );
+      assert( fabs(rp-cones[c]) < 0.03*cones[c] );
+    }
+    kin.polarMin = -1.;  kin.polarMax = 1.;
+    kin.phiValue = -1.;
+  }
+
+					// ---- histograms: 1D PT with ETA from
+					// the parameters, 2D PT and ETA
+  {
+    const char* f1 = "testGenFakeRecipes1.txt";
+    const char* f2 = "testGenFakeRecipes2.txt";
+    writeFile(f1, "# pt\nx 2 4 8\nw 1 3\n");
+    writeFile(f2, "x 2 4 8\ny 1.5 2.5 3.5\nw 1 0\n  0 1\n");
+    GenFakeRecipes r;
+    r.add(8, 4., 0, 0., f1);
+    r.add(8, 4., 0, 0., f2);
+    r.add(8, 4., 0, 0.2, f2);
+    for ( int k=0; k<r.size(); k++ ) {
+      GenFakeRecipes::Recipe& rk = r.recipe(k);
+      assert( rk.hist.read(rk.histFile) == 0 );
+      rk.pdgId = 211;
+      rk.mass  = MPI;
+    }
+					// ETA 0.3 and PHI 1 from the
+					// parameters, the axis with a cone
+    kin.polarMin = 0.3;  kin.polarMax = 0.3;
+    kin.phiValue = 1.;
+    long nMomentum = kin.nMomentum, nLow = 0, n1 = 0;
+    double sp2 = 0.;
+    for ( int iev=0; iev<nev/10; iev++ ) {
+      r.generate(&engine, kin, hep);
+      assert( hep.NHEP == 12 );
+      checkBlock(0, 12, 211, MPI);
+      for ( int i=0; i<4; i++ ) {
+	double pt = ptOf(i);
+	assert( pt > 2.-1.e-9 && pt < 8.+1.e-9 );
+	assert( fabs(etaOf(i)-0.3) < 1.e-9 && fabs(phiOf(i)-1.) < 1.e-9 );
+	if ( pt < 4. ) nLow++;
+	n1++;
+      }
+					// 2D: only the cells (2-4, 1.5-2.5)
+					// and (4-8, 2.5-3.5)
+      for ( int i=4; i<8; i++ ) {
+	double pt = ptOf(i), eta = etaOf(i);
+	assert( pt > 2.-1.e-9 && pt < 8.+1.e-9 );
+	if ( pt < 4. ) assert( eta > 1.5-1.e-9 && eta < 2.5+1.e-9 );
+	else           assert( eta > 2.5-1.e-9 && eta < 3.5+1.e-9 );
+      }
+					// with a cone y is the eta distance
+					// from the axis, phi is smeared
+      for ( int i=8; i<12; i++ ) {
+	double pt = ptOf(i), dy = etaOf(i) - 0.3, dp = phiOf(i) - 1.;
+	if ( pt < 4. ) assert( dy > 1.5-1.e-9 && dy < 2.5+1.e-9 );
+	else           assert( dy > 2.5-1.e-9 && dy < 3.5+1.e-9 );
+	sp2 += dp*dp;
+      }
+    }
+					// no PT from the parameters, PT from
+					// the 1D weights 1:3
+    assert( kin.nMomentum == nMomentum );
+    double fLow = double(nLow)/n1;
+    assert( fabs(fLow-0.25) < 5.*sqrt(0.25*0.75/n1) );
+    assert( fabs(sqrt(sp2/n1)-0.2) < 0.05*0.2 );
+    kin.polarMin = -1.;  kin.polarMax = 1.;
+    kin.phiValue = -1.;
+    remove(f1);
+    remove(f2);
+  }
+
+					// ---- NMXHEP truncation
+  {
+    GenFakeRecipes r;
+    r.add(8 , NMXHEP-10, 0, 0., "");
+    r.add(10, 20., 0, 0., "");
+    r.add(12, 5., 0, 0., "");
+    r.recipe(0).pdgId = 211;   r.recipe(0).mass = MPI;
+    r.recipe(1).pdgId = 321;   r.recipe(1).mass = MK;
+    r.recipe(2).pdgId = 2212;  r.recipe(2).mass = 0.93827;
+    spoil();
+    r.generate(&engine, kin, hep);
+    assert( hep.NHEP == NMXHEP );
+    checkBlock(0, NMXHEP-10, 211, MPI);
+    checkBlock(NMXHEP-10, 10, 321, MK);
+  }
+
+  cout << "testGenFakeRecipes: OK" << endl;
+  return 0;
+}
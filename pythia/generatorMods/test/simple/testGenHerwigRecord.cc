@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenHerwigRecord.cc
+// Purpose: Checks GenHerwigRecord on the saved HERWIG records of
+//          herwigRecordSample.txt and on large random records: the hard
+//          process row and pthat agree with the scan HerwigModule used
+//          before, also when the index is reused.
+//
+//   usage: testGenHerwigRecord [sample file]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "generatorMods/GenHerwigRecord.hh"
+
+using std::cout;
+using std::endl;
+
+static HEPEVT hep;
+static HEPEV4 hep4;
+
+					// next "event NHEP" block, false at EOF
+static bool readEvent(std::istream& in)
+{
+  std::string line;
+  while ( std::getline(in,line) ) {
+    if ( line.empty() || line[0] == '#' ) continue;
+    std::istringstream head(line);
+    std::string key;
+    head >> key >> hep.NHEP;
+    assert(key == "event" && hep.NHEP > 0 && hep.NHEP <= NMXHEP);
+    for ( int i=0; i<hep.NHEP; i++ ) {
+      in >> hep.ISTHEP[i] >> hep.IDHEP[i]
+	 >> hep.JMOHEP[i][0] >> hep.JMOHEP[i][1]
+	 >> hep.JDAHEP[i][0] >> hep.JDAHEP[i][1];
+      for ( int k=0; k<5; k++ ) in >> hep.PHEP[i][k];
+      assert(in);
+    }
+    return true;
+  }
+  return false;
+}
+
+					// the old HerwigModule::fillHepevt scan
+static void compare(const GenHerwigRecord& r)
+{
+  assert(r.nhep() == hep.NHEP);
+  int i = 0;
+  while ( i < hep.NHEP && hep.ISTHEP[i] != 123 ) i++;
+  assert(r.hardProcess() == ( i < hep.NHEP ? i : -1 ));
+}
+
+int main(int argc, char* argv[])
+{
+  const char* file = ( argc > 1 ) ? argv[1] 
+    : "generatorMods/test/simple/herwigRecordSample.txt";
+  std::ifstream in(file);
+  assert(in);
+
+  GenHerwigRecord r;
+  const double pthat[] = { 50., 0., 0. };
+  int nev = 0;
+  while ( readEvent(in) ) {
+    r.index(hep);
+    compare(r);
+    r.fillHepev4(hep,hep4,0.25*(nev+1));
+    assert(hep4.EVENTWEIGHTLH == 0.25*(nev+1));
+    assert(std::fabs(hep4.SCALELH[5]-pthat[nev]) < 1.e-5);
+					// first of the two ISTHEP=123 rows
+    if ( nev == 0 ) assert(r.hardProcess() == 6);
+    if ( nev == 1 ) assert(r.hardProcess() == -1);
+    nev++;
+  }
+  assert(nev == 3);
+  cout << "testGenHerwigRecord: " << nev << " saved records OK" << endl;
+
+					// Jimmy ttbar sized random records
+  srand(4711);
+  const int statuses[] = { 1, 2, 3, 120, 121, 124, 141, 155, 195, 197, 1001 };
+  for ( int k=0; k<20; k++ ) {
+    hep.NHEP = 1100 + 100*k;
+    for ( int i=0; i<hep.NHEP; i++ ) {
+      hep.ISTHEP[i]  = statuses[rand()%11];
+      hep.PHEP[i][0] = hep.PHEP[i][1] = 1.;
+    }
+					// none, early, late hard process
+    if ( k%3 ) hep.ISTHEP[ k%3 == 1 ? 6 : hep.NHEP-1 ] = 123;
+    r.index(hep);
+    compare(r);
+  }
+  cout << "testGenHerwigRecord: 20 random records up to " << hep.NHEP
+       << " rows OK" << endl;
+  return 0;
+}
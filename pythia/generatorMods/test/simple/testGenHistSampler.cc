@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenHistSampler.cc
+// Purpose: Checks GenHistSampler: the alias table reproduces the cell
+//          probabilities of a 1D histogram with variable bins (and
+//          empty ones) and of a 2D histogram read from a text file,
+//          samples stay inside their cell.
+//
+//   usage: testGenHistSampler [nsamples]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "generatorMods/GenHistSampler.hh"
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+					// fraction of u in [0,1) going to
+					// each cell, on a fine grid
+static void sweep(const GenHistSampler& h, std::vector<double>& frac)
+{
+  int m = 100000*h.nCells();
+  frac.assign(h.nCells(), 0.);
+  for ( int j=0; j<m; j++ ) frac[h.cell((j+0.5)/m)] += 1./m;
+}
+
+int main(int argc, char* argv[])
+{
+  long n = ( argc > 1 ) ? atol(argv[1]) : 2000000;
+  HepJamesRandom engine(31415);
+
+					// ---- 1D, variable bins, empty bins
+  std::vector<double> x, w, none;
+  x.push_back(0.);
+  for ( int i=0; i<500; i++ ) {
+    x.push_back(x.back() + 0.1 + 0.01*(i%7));
+    w.push_back( (i%11 == 3) ? 0. : exp(-0.01*i)*(1.+0.5*sin(0.3*i)) );
+  }
+  GenHistSampler h1;
+  assert( h1.init(x, none, w) == 0 );
+  assert( h1.dim() == 1 && h1.nCells() == 500 );
+
+  std::vector<double> frac;
+  sweep(h1, frac);
+  for ( int c=0; c<h1.nCells(); c++ ) {
+    assert( fabs(frac[c]-h1.probability(c)) < 1.e-3/h1.nCells() );
+    if ( w[c] == 0. ) assert( frac[c] == 0. );
+  }
+
+  std::vector<double> xs(n);
+  h1.shootArray(&engine, n, &xs[0]);
+  std::vector<long> count(h1.nCells());
+  for ( long i=0; i<n; i++ ) {
+    assert( xs[i] >= x.front() && xs[i] <= x.back() );
+    int c = 0;
+    while ( xs[i] >= x[c+1] ) c++;
+    count[c]++;
+  }
+  double chi2 = 0.;
+  int ndf = 0;
+  for ( int c=0; c<h1.nCells(); c++ ) {
+    double mu = n*h1.probability(c);
+    if ( mu == 0. ) { assert( count[c] == 0 ); continue; }
+    chi2 += (count[c]-mu)*(count[c]-mu)/mu;
+    ndf++;
+  }
+  cerr << "testGenHistSampler: 1D " << h1.nCells() << " cells, chi2/ndf "
+       << chi2 << "/" << ndf << endl;
+  assert( chi2 < ndf + 6.*sqrt(2.*ndf) );
+
+					// ---- 2D from a text file
+  const char* file = "testGenHistSampler.txt";
+  FILE* f = fopen(file, "w");
+  fprintf(f, "# pt vs eta\nx 0 1 2 5 10 50\ny -2 -1 0 1 2\nw\n");
+  for ( int iy=0; iy<4; iy++ ) {
+    for ( int ix=0; ix<5; ix++ ) fprintf(f, " %g", 1.+ix+10.*iy);
+    fprintf(f, "\n");
+  }
+  fclose(f);
+
+  GenHistSampler h2;
+  assert( h2.read(file) == 0 );
+  assert( h2.dim() == 2 && h2.nCells() == 20 && h2.nx() == 5 );
+  sweep(h2, frac);
+  for ( int c=0; c<h2.nCells(); c++ ) {
+    double wc = 1. + c%5 + 10.*(c/5);
+    assert( fabs(h2.probability(c) - wc/360.) < 1.e-12 );
+    assert( fabs(frac[c]-h2.probability(c)) < 1.e-3/h2.nCells() );
+  }
+  std::vector<double> ys(n);
+  h2.shootArray(&engine, n, &xs[0], &ys[0]);
+  long inCorner = 0;
+  for ( long i=0; i<n; i++ ) {
+    assert( xs[i] >= 0. && xs[i] <= 50. && ys[i] >= -2. && ys[i] <= 2. );
+    if ( xs[i] >= 10. && ys[i] >= 1. ) inCorner++;
+  }
+					// cell 19 has weight 35/360
+  double mu = n*35./360.;
+  assert( fabs(inCorner-mu) < 6.*sqrt(mu) );
+					// x only: the same x as with y
+  {
+    HepJamesRandom e1(2718), e2(2718);
+    std::vector<double> xa(1000), ya(1000), xb(1000);
+    h2.shootArray(&e1, 1000, &xa[0], &ya[0]);
+    h2.shootArray(&e2, 1000, &xb[0]);
+    for ( int i=0; i<1000; i++ ) assert( xa[i] == xb[i] );
+  }
+
+					// ---- bad input
+  std::vector<double> bad(3, 1.);
+  assert( h1.init(x, none, bad) != 0 && h1.empty() );
+					// an empty table gives zeros
+  double ex = 1., ey = 1.;
+  h1.shoot(&engine, ex, ey);
+  assert( ex == 0. && ey == 0. );
+  remove(file);
+
+  cout << "testGenHistSampler: OK" << endl;
+  return 0;
+}
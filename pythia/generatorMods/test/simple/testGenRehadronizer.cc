@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenRehadronizer.cc
+// Purpose: Checks the selection distributions of GenRehadronizer with a
+//          toy generator. A parton level event has a flat x in [0,1) and
+//          each hadronisation passes with probability p(x) = 0.02+0.3x,
+//          so selecting and regenerating gives x distributed as p(x).
+//          - weighted mode: the weighted x histogram follows p(x), the
+//            mean weight per hard process is the mean of p, and the
+//            kept event is the first selected try
+//          - first success: x follows 1-(1-p(x))^N instead, the bias
+//            the weights remove
+//
+//   usage: testGenRehadronizer [nevents]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/GenRehadronizer.hh"
+
+using std::cout;
+using std::endl;
+
+static const int NBINS  = 20;
+static const int NTRIES = 10;
+
+static double prob(double x) { return 0.02 + 0.3*x; }
+
+class ToyRehadronizer : public GenRehadronizer {
+public:
+  ToyRehadronizer(HepRandomEngine* e)
+    : engine(e), x(0), ntry(0), firstSelected(-1), kept(-1) {}
+  HepRandomEngine* engine;
+  double x;                             // parton level
+  int    ntry;                          // hadron level: try number
+  int    firstSelected;
+  int    kept;
+protected:
+  void newPartonLevel()     { x = RandFlat::shoot(engine); ntry = -1;
+                              firstSelected = -1; }
+  void restorePartonLevel() {}
+  bool hadronize() {
+    ntry++;
+    bool pass = RandFlat::shoot(engine) < prob(x);
+    if ( pass && firstSelected < 0 ) firstSelected = ntry;
+    return pass;
+  }
+  void saveHadronLevel()    { kept = ntry; }
+  void restoreHadronLevel() { ntry = kept; }
+};
+
+					// fractions of a density in the bins
+static std::vector<double> fractions(double (*f)(double))
+{
+  std::vector<double> frac(NBINS, 0.);
+  double sum = 0.;
+  for ( int k=0; k<NBINS; k++ ) {
+    for ( int i=0; i<100; i++ ) frac[k] += f((k + (i+0.5)/100.)/NBINS);
+    sum += frac[k];
+  }
+  for ( int k=0; k<NBINS; k++ ) frac[k] /= sum;
+  return frac;
+}
+
+static double firstSuccess(double x) { return 1. - pow(1.-prob(x), NTRIES); }
+
+					// chi2 of weighted bin sums against
+					// the fractions of a density
+static double chi2(const std::vector<double>& w, const std::vector<double>& w2,
+		   const std::vector<double>& frac)
+{
+  double sum = 0.;
+  for ( int k=0; k<NBINS; k++ ) sum += w[k];
+  double c = 0.;
+  for ( int k=0; k<NBINS; k++ ) {
+    double d = w[k] - sum*frac[k];
+    c += d*d/w2[k];
+  }
+  return c;
+}
+
+int main(int argc, char* argv[])
+{
+  int n = ( argc > 1 ) ? atoi(argv[1]) : 200000;
+
+  HepJamesRandom engine(4711);
+  ToyRehadronizer toy(&engine);
+  std::vector<double> fP = fractions(prob), fFirst = fractions(firstSuccess);
+
+					// ---- weighted
+  std::vector<double> w(NBINS, 0.), w2(NBINS, 0.);
+  double sumW = 0.;
+  long   nHard = 0;
+  for ( int i=0; i<n; i++ ) {
+    double weight = toy.select(NTRIES, true);
+    assert( weight > 0. && weight <= 1. );
+    assert( weight == double(toy.nFound())/NTRIES );
+    assert( toy.nExec() == NTRIES*toy.nHard() );
+    assert( toy.ntry == toy.firstSelected );
+    int k = int(toy.x*NBINS);
+    w [k] += weight;
+    w2[k] += weight*weight;
+    sumW  += weight;
+    nHard += toy.nHard();
+  }
+  double cP     = chi2(w, w2, fP);
+  double cFirst = chi2(w, w2, fFirst);
+					// mean of p over [0,1) is 0.17
+  double meanW  = sumW/nHard;
+  cout << "testGenRehadronizer: weighted, chi2/" << NBINS << " p(x) "
+       << (cP < 45. ? "< 45" : "too large") << ", first success "
+       << (cFirst > 200. ? "> 200" : "too small") << endl;
+  assert( cP < 45. && cFirst > 200. );
+  assert( fabs(meanW - 0.17) < 0.005 );
+
+					// ---- first success
+  std::vector<double> h(NBINS, 0.);
+  for ( int i=0; i<n; i++ ) {
+    assert( toy.select(NTRIES, false) == 1. );
+    assert( toy.nFound() == 1 && toy.ntry == toy.firstSelected );
+    h[int(toy.x*NBINS)] += 1.;
+  }
+  cP     = chi2(h, h, fP);
+  cFirst = chi2(h, h, fFirst);
+  cout << "testGenRehadronizer: first success, chi2/" << NBINS << " p(x) "
+       << (cP > 200. ? "> 200" : "too small") << ", first success "
+       << (cFirst < 45. ? "< 45" : "too large") << endl;
+  assert( cP > 200. && cFirst < 45. );
+
+  cout << "testGenRehadronizer: OK" << endl;
+  return 0;
+}
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGenVertexSmearer.cc
+// Purpose: Equivalence of the batched GenVertexSmearer with the
+//          original per-event GenPrimVertModule loop (reproduced below
+//          with float talk-to values), for the gaussian and betaStar z
+//          models with and without betaStar beam widths: same seeds must
+//          give the same z and t, and x, y within 1e-7 cm (the width
+//          table against the float widths of the old loop).
+//
+//   usage: testGenVertexSmearer [nevents] [nv] [parameter file]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "CLHEP/Random/RandGaussT.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/GendLdz.hh"
+#include "generatorMods/GenVertexSmearer.hh"
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+// GenPrimVertModule defaults, kept as floats like the talk-tos
+static float sigmaX = 25.7E-4, sigmaY = 25.8E-4, sigmaZ = 30., sigmaT = 1.3;
+static float pvX = 0.01, pvY = -0.02, pvZ = 1.5, dxdz = 1.e-4, dydz = -2.e-4;
+static float emX = 1.26E-7, emY = 1.24E-7, bX = 38.6, bY = 38.0;
+static float z0X = 14.2, z0Y = -9.2, spacing = 396.;
+static int   nBunches = 2;
+
+// the per-event loop as it was in GenPrimVertModule::event()
+static void reference(HepRandomEngine* engine, int nv, GendLdz* zgen,
+		      bool useWidth, double* out)
+{
+  float sx = sigmaX, sy = sigmaY;
+  double* grn = new double[4*nv];
+  double* urn = new double[nv];
+  if (nv > 1) RandFlat::shootArray(engine, nv-1, urn);
+  RandGaussT::shootArray(engine, 4*nv, grn, 0.0, 1.0);
+  for (int i=0; i<nv; i++) {
+    double z = zgen ? zgen->throwZ(engine) : sigmaZ*grn[4*i+2]+pvZ;
+    if (useWidth) {
+      sx = sqrt(emX*(bX+pow(z-z0X,2)/bX));
+      sy = sqrt(emY*(bY+pow(z-z0Y,2)/bY));
+    }
+    out[4*i  ] = sx*grn[4*i  ]+pvX+dxdz*z;
+    out[4*i+1] = sy*grn[4*i+1]+pvY+dydz*z;
+    out[4*i+2] = z;
+    int bunch = (i==0) ? 0 : int((2*nBunches+1)*urn[i-1])-nBunches;
+    out[4*i+3] = (spacing*bunch + sigmaT*grn[4*i+3])*1.e-9;
+  }
+  delete [] grn;
+  delete [] urn;
+}
+
+int main(int argc, char* argv[])
+{
+  const int nev = ( argc > 1 ) ? atoi(argv[1]) : 2000;
+  const int nv  = ( argc > 2 ) ? atoi(argv[2]) : 40;
+  const char* file = ( argc > 3 ) ? argv[3] 
+    : "generatorMods/data/GendLdzParms.txt";
+
+  GendLdz zgen;
+  zgen.setParmFile(file);
+  assert( zgen.init() == 0 );
+  assert( zgen.getParms(200000, 0) == 0 );
+
+  GenVertexSmearer::Beam beam = { pvX, pvY, pvZ, dxdz, dydz, 
+				  sigmaX, sigmaY, sigmaZ, sigmaT, 
+				  nBunches, spacing };
+  GenVertexSmearer::BetaStarWidth width = { emX, bX, z0X, emY, bY, z0Y };
+
+  double* ref = new double[4*nv];
+  for ( int mode=0; mode<4; mode++ ) {
+    bool useWidth = mode & 1;
+    GendLdz* zg   = ( mode & 2 ) ? &zgen : 0;
+
+    GenVertexSmearer smearer;
+    smearer.setBeam(beam);
+    smearer.setBetaStarWidth(useWidth ? &width : 0);
+    smearer.setZGenerator(zg);
+
+    HepJamesRandom e1(1234), e2(1234);
+    double dxy = 0., dz = 0., dt = 0.;
+    for ( int iev=0; iev<nev; iev++ ) {
+      int n = 1 + iev % nv;
+      reference(&e1, n, zg, useWidth, ref);
+      const double* v = smearer.generate(&e2, n);
+      for ( int i=0; i<n; i++ ) {
+	dxy = std::max(dxy, fabs(v[4*i  ]-ref[4*i  ]));
+	dxy = std::max(dxy, fabs(v[4*i+1]-ref[4*i+1]));
+	dz  = std::max(dz , fabs(v[4*i+2]-ref[4*i+2]));
+	dt  = std::max(dt , fabs(v[4*i+3]-ref[4*i+3]));
+      }
+    }
+    cerr << "mode " << mode << " (width " << useWidth << ", betaStar z "
+	 << ( zg != 0 ) << "): max |dx|,|dy| " << dxy << " cm, |dz| " << dz
+	 << " cm, |dt| " << dt << " s" << endl;
+					// x, y: ~4e-8 cm with the width table
+					// (float widths in the old loop, 6e-6
+					// relative interpolation), else same
+    assert( useWidth ? dxy < 1.e-7 : dxy == 0. );
+    assert( dz == 0. && dt == 0. );
+  }
+					// table against the exact width
+  GenVertexSmearer smearer;
+  smearer.setBeam(beam);
+  smearer.setBetaStarWidth(&width);
+  double worst = 0.;
+  for ( double z=-250.; z<=250.; z+=0.0137 ) {
+    double sx, sy;
+    smearer.widths(z, sx, sy);
+    double ex = GenVertexSmearer::exactWidth(emX, bX, z0X, z);
+    double ey = GenVertexSmearer::exactWidth(emY, bY, z0Y, z);
+    worst = std::max(worst, std::max(fabs(sx/ex-1.), fabs(sy/ey-1.)));
+  }
+  cerr << "width table: max relative error " << worst << endl;
+  assert( worst < 1.e-5 );
+
+  delete [] ref;
+  cout << "testGenVertexSmearer: OK" << endl;
+  return 0;
+}
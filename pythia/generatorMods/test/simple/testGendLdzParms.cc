@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGendLdzParms.cc
+// Purpose: Checks the GendLdz parameter file handling: the text file
+//          and its makeGendLdzParms binary (mmap'd) give the same
+//          parameter sets, and run ranges appended past the old last
+//          run are picked up without recompiling, and a missing or
+//          corrupt file, read on the first getParms(), is refused.
+//
+//   usage: testGendLdzParms [text parameter file]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "generatorMods/GendLdz.hh"
+
+using std::cout;
+using std::endl;
+
+int main(int argc, char* argv[])
+{
+  const char* text = ( argc > 1 ) ? argv[1] 
+    : "generatorMods/data/GendLdzParms.txt";
+  const char* bin  = "testGendLdzParms.bin";
+  const char* bin2 = "testGendLdzParms2.bin";
+
+  std::vector<GendLdz::RunBin> bins;
+  assert( GendLdz::readTextParms(text, bins) == 0 );
+  assert( GendLdz::writeParmFile(bin, bins) == 0 );
+
+  GendLdz fromText, fromBin;
+  fromText.setParmFile(text);
+  fromBin .setParmFile(bin);
+  assert( fromText.init() == 0 && fromBin.init() == 0 );
+
+  for ( int run=bins.front().firstRun - 100; run<=bins.back().firstRun; run+=37 ) {
+    assert( fromText.getParms(run, 0) == 0 );
+    assert( fromBin .getParms(run, 0) == 0 );
+    for ( int k=0; k<GendLdz::NPARMS; k++ ) {
+      assert( fromText.parms()[k] == fromBin.parms()[k] );
+    }
+  }
+  assert( fromBin.nBins() == int(bins.size()) );
+  assert( fromBin.lastRun() == bins.back().firstRun );
+  assert( fromBin.getParms(bins.back().firstRun + 1, 0) != 0 );
+
+					// append a run range and a new end
+					// of range, unsorted
+  GendLdz::RunBin extra = bins[bins.size()/2];
+  extra.firstRun = bins.back().firstRun + 1000;
+  extra.parms[2] = 25.;
+  GendLdz::RunBin last = extra;
+  last.firstRun += 1000;
+  bins.insert(bins.begin(), last);
+  bins.insert(bins.begin(), extra);
+  bins.push_back(bins[1]);            // repeated first run, dropped
+  bins.back().parms[2] = -1.;
+  FILE* f = fopen("testGendLdzParms.txt", "w");
+  for ( unsigned i=0; i<bins.size(); i++ ) {
+    fprintf(f, "%d", bins[i].firstRun);
+    for ( int k=0; k<GendLdz::NPARMS; k++ ) fprintf(f, " %.17g", bins[i].parms[k]);
+    fprintf(f, "\n");
+  }
+  fclose(f);
+
+  std::vector<GendLdz::RunBin> more;
+  assert( GendLdz::readTextParms("testGendLdzParms.txt", more) == 0 );
+  assert( more.size() == bins.size() - 1 );
+  assert( more.back().firstRun == last.firstRun && more.back().parms[2] == 25. );
+  assert( GendLdz::writeParmFile(bin2, more) == 0 );
+
+  GendLdz extended;
+  extended.setParmFile(bin2);
+  assert( extended.init() == 0 );
+  assert( extended.getParms(extra.firstRun + 500, 0) == 0 );
+  assert( extended.parms()[2] == 25. );
+  assert( extended.lastRun() == last.firstRun );
+
+					// a corrupt file is refused by the
+					// first getParms(), as is a missing
+					// one; init() only takes the name
+  f = fopen(bin2, "r+");
+  fseek(f, 12, SEEK_SET);
+  int bad = 7;
+  fwrite(&bad, sizeof(int), 1, f);
+  fclose(f);
+  GendLdz corrupt;
+  corrupt.setParmFile(bin2);
+  assert( corrupt.init() == 0 && corrupt.nBins() == 0 );
+  assert( corrupt.getParms(200000, 0) != 0 && corrupt.parms() == 0 );
+  GendLdz missing;
+  missing.setParmFile("testGendLdzParms.none");
+  assert( missing.init() == 0 );
+  assert( missing.getParms(200000, 0) != 0 );
+
+  remove(bin);
+  remove(bin2);
+  remove("testGendLdzParms.txt");
+  cout << "testGendLdzParms: OK, " << more.size() << " run ranges" << endl;
+  return 0;
+}
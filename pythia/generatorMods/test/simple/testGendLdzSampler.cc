@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testGendLdzSampler.cc
+// Purpose: Statistical equivalence of the tabulated inverse-CDF
+//          GendLdz::throwZ() and the original accept-reject sampler,
+//          for a few run ranges with different betaStar shapes.
+//          Compares 5 cm histograms with a two-sample chi2 and the
+//          means/widths.
+//
+//   usage: testGendLdzSampler [nz] [parameter file]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "generatorMods/GendLdz.hh"
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+static const int    NBINS = 72;
+static const double ZLO   = -180.;
+static const double ZHI   =  180.;
+
+static void fill(std::vector<long>& h, double z, double& s1, double& s2)
+{
+  int k = int((z - ZLO) / (ZHI - ZLO) * NBINS);
+  assert( k >= 0 && k < NBINS );
+  h[k]++;
+  s1 += z;
+  s2 += z*z;
+}
+
+int main(int argc, char* argv[])
+{
+  const int n = ( argc > 1 ) ? atoi(argv[1]) : 1000000;
+  const char* file = ( argc > 2 ) ? argv[2] 
+    : "generatorMods/data/GendLdzParms.txt";
+  const int runs[] = { 141597, 153374, 200000, 293798 };
+
+  GendLdz gen;
+  gen.setParmFile(file);
+  assert( gen.init() == 0 );
+  HepJamesRandom engine(4711);
+  std::vector<double> batch(n);
+
+  for ( unsigned r=0; r<sizeof(runs)/sizeof(runs[0]); r++ ) {
+    assert( gen.getParms(runs[r], 0) == 0 );
+
+    std::vector<long> ha(NBINS,0), hb(NBINS,0);
+    double a1 = 0., a2 = 0., b1 = 0., b2 = 0.;
+
+    for ( int i=0; i<n; i++ ) fill(ha, gen.throwZAcceptReject(&engine), a1, a2);
+    gen.throwZ(&engine, n, &batch[0]);
+    for ( int i=0; i<n; i++ ) fill(hb, batch[i], b1, b2);
+
+					// two-sample chi2, equal statistics
+    double chi2 = 0.;
+    int    ndf  = -1;
+    for ( int k=0; k<NBINS; k++ ) {
+      if ( ha[k] + hb[k] < 20 ) continue;
+      double d = double(ha[k] - hb[k]);
+      chi2 += d*d/(ha[k] + hb[k]);
+      ndf++;
+    }
+    double ma = a1/n, mb = b1/n;
+    double sa = sqrt(a2/n - ma*ma), sb = sqrt(b2/n - mb*mb);
+
+    cerr << "run " << runs[r] << ": chi2/ndf = " << chi2 << "/" << ndf
+	 << ", mean " << ma << " / " << mb
+	 << ", rms " << sa << " / " << sb << endl;
+
+    assert( chi2 < ndf + 5.*sqrt(2.*ndf) );
+    assert( fabs(ma - mb) < 5.*sqrt(2./n)*sa );
+    assert( fabs(sa - sb) < 5.*sqrt(1./n)*sa );
+
+					// single and batch calls agree
+    HepJamesRandom e1(99), e2(99);
+    double z[16];
+    gen.throwZ(&e1, 16, z);
+    for ( int i=0; i<16; i++ ) assert( gen.throwZ(&e2) == z[i] );
+  }
+
+  cout << "testGendLdzSampler: OK" << endl;
+  return 0;
+}
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testInverseCdfTable.cc
+// Purpose: InverseCdfTable must reproduce, number by number, the
+//          linear-search inversion of the original MBR routines
+//          (MinBiasModule::generate_random_o2, 1+cos^2 on [0,pi])
+//          for the same random engine and seed.
+//
+//   usage: testInverseCdfTable [n]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "CLHEP/Random/RandFlat.h"
+#include "generatorMods/InverseCdfTable.hh"
+
+using std::cout;
+using std::endl;
+
+static double pfun(double y) { return 1.0+cos(y)*cos(y); }
+
+					// the original routine: table rebuilt
+					// and searched linearly on every call
+static double oldRandomO2(HepRandomEngine* engine)
+{
+  double pi = M_PI;
+  double xmin=0.0, xmax=pi;
+  double x[501], f[501];
+  double dx=(xmax-xmin)/500.0;
+  x[0]=xmin;
+  f[0]=0.0;
+  for(int i=0;i<500;i++){
+    x[i+1]=x[i]+dx;
+    f[i+1]=f[i]+pfun(x[i]-.5*dx);
+  }
+  double fsum=f[500];
+  for(int i=1;i<501;i++) f[i]=f[i]/fsum;
+
+  double rn=1.1;
+  while(rn<=0.||rn>1.) rn=RandFlat::shoot(engine);
+  int ipt=0;
+  for(int i=0;i<500;i++){
+    if(rn<=f[i+1]){ ipt=i; break; }
+  }
+  return x[ipt]+(rn-f[ipt])*((x[ipt+1]-x[ipt])/(f[ipt+1]-f[ipt]));
+}
+
+int main(int argc, char* argv[])
+{
+  long n = ( argc > 1 ) ? atol(argv[1]) : 1000000;
+
+  InverseCdfTable table;
+  assert( table.empty() );
+  {
+    double dx = M_PI/500.0;
+    std::vector<double> x(501), w(500);
+    x[0] = 0.0;
+    for ( int i=0; i<500; i++ ) {
+      x[i+1] = x[i]+dx;
+      w[i]   = pfun(x[i]-.5*dx);
+    }
+    table.init(x, w);
+  }
+  assert( table.cells() == 500 );
+  assert( table.cdf(0) == 0. && table.cdf(500) == 1. );
+  assert( table.invert(1.) == table.node(500) );
+					// node values are exact
+  for ( int i=1; i<=500; i++ ) {
+    assert( table.invert(table.cdf(i)) == table.node(i) );
+  }
+
+  HepJamesRandom e1(4711), e2(4711);
+  std::vector<double> ref(n);
+  for ( long i=0; i<n; i++ ) ref[i] = oldRandomO2(&e1);
+  long nDiff = 0;
+  for ( long i=0; i<n; i++ ) {
+    if ( table.shoot(&e2) != ref[i] ) nDiff++;
+  }
+
+  cout << "testInverseCdfTable: " << n << " numbers, " << nDiff
+       << " differences" << endl;
+  assert( nDiff == 0 );
+  cout << "testInverseCdfTable: OK" << endl;
+  return 0;
+}
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testLesEventIndex.cc
+// Purpose: Checks LesEventIndex on a generated Les Houches file: the
+//          offsets match a line by line parse, the sidecar index is
+//          read back and rejected once the event file changes, and the
+//          slices handed to the Fortran readers contain exactly the
+//          header, the requested events and the footer, also from a
+//          partial index, which is never saved.
+//
+//   usage: testLesEventIndex [nevents]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "generatorMods/LesEventIndex.hh"
+
+using std::cout;
+using std::endl;
+
+static std::string slurp(const std::string& fileName)
+{
+  std::ifstream in(fileName.c_str(), std::ios::in | std::ios::binary);
+  std::ostringstream s;
+  s << in.rdbuf();
+  return s.str();
+}
+
+int main(int argc, char* argv[])
+{
+  int n = ( argc > 1 ) ? atoi(argv[1]) : 1000;
+  if ( n < 8 ) n = 8;
+  const std::string file  = "testLesEventIndex.lhe";
+  const std::string index = LesEventIndex::indexName(file);
+  const std::string slice = "testLesEventIndex.slice";
+
+					// header with look-alike tags,
+					// events of varying length
+  std::string header =
+    "<LesHouchesEvents version=\"1.0\">\n"
+    "<header>\n"
+    "# <event> blocks follow\n"
+    "  <eventgroup>\n"
+    "</header>\n"
+    "<init>\n"
+    " 2212 -2212 0.98E+03 0.98E+03 0 0 10042 10042 3 1\n"
+    "</init>\n";
+  std::string footer = "</LesHouchesEvents>\n";
+  std::vector<std::string> events;
+  srand(2718);
+  for ( int i=0; i<n; i++ ) {
+    std::ostringstream e;
+    e << ( i%3 == 0 ? "<event>" : i%3 == 1 ? "  <event npLO=\" 1 \">" 
+	                                   : "<event>\r" ) << "\n";
+    int np = 4 + rand()%10;
+    e << np << " 661 " << i << ". 0.91E+02 0.78E-02 0.12\n";
+    for ( int k=0; k<np; k++ ) {
+      e << "  21 -1 0 0 501 502 0.0 0.0 " << rand()%1000 
+	<< ". " << rand()%1000 << ". 0.0 0. 9.\n";
+    }
+    e << "</event>\n";
+    events.push_back(e.str());
+  }
+  {
+    std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+    out << header;
+    for ( int i=0; i<n; i++ ) out << events[i];
+    out << footer;
+  }
+  remove(index.c_str());
+
+  LesEventIndex idx;
+  assert(idx.load(file) == 0);
+  assert(idx.nEvents() == n);
+  assert(idx.headerEnd() == off_t(header.size()));
+  off_t pos = header.size();
+  for ( int i=0; i<n; i++ ) {
+    assert(idx.offset(i) == pos && idx.size(i) == off_t(events[i].size()));
+    pos += events[i].size();
+  }
+  assert(idx.footer() == pos);
+  assert(idx.fileSize() == pos + off_t(footer.size()));
+
+					// sidecar written by load()
+  LesEventIndex idx2;
+  assert(idx2.read(index,file) == 0);
+  assert(idx2.nEvents() == n && idx2.footer() == idx.footer());
+  for ( int i=0; i<n; i++ ) assert(idx2.offset(i) == idx.offset(i));
+
+					// slices = header + events + footer
+  const long first[] = { 0, 1, n/2, n-1, n/3 };
+  const long count[] = { 0, 5, 0,   7,   n/4 };
+  for ( int k=0; k<5; k++ ) {
+    assert(idx.writeSlice(file,slice,first[k],count[k]) == 0);
+    std::string expect = header;
+    long last = ( count[k] > 0 && first[k]+count[k] < n ) ? 
+      first[k]+count[k] : n;
+    for ( long i=first[k]; i<last; i++ ) expect += events[i];
+    expect += footer;
+    assert(slurp(slice) == expect);
+					// and the slice indexes as such
+    LesEventIndex s;
+    assert(s.build(slice) == 0 && s.nEvents() == last-first[k]);
+  }
+  assert(idx.writeSlice(file,slice,n,1) != 0);
+  assert(idx.writeSlice(file,slice,-1,1) != 0);
+
+					// a job only scans as far as it
+					// reads, and doesn't save that
+  remove(index.c_str());
+  LesEventIndex part;
+  assert(part.load(file,"",3) == 0 && !part.complete());
+  assert(part.nEvents() == 4 && part.offset(3) == idx.offset(3));
+  assert(part.write(index) != 0);
+  FILE* none = fopen(index.c_str(),"rb");
+  assert(none == 0);
+  assert(part.writeSlice(file,slice,1,2) == 0);
+  assert(slurp(slice) == header + events[1] + events[2] + footer);
+  assert(part.writeSlice(file,slice,1,3) != 0);
+  assert(part.load(file,"",n+5) == 0 && part.complete());
+  assert(part.nEvents() == n && part.read(index,file) == 0);
+					// no temporary file left behind
+  std::ostringstream tmp;
+  tmp << index << ".tmp" << getpid();
+  FILE* left = fopen(tmp.str().c_str(),"rb");
+  assert(left == 0);
+
+					// a changed file makes the index stale
+  {
+    std::ofstream out(file.c_str(), std::ios::out | std::ios::app);
+    out << "\n";
+  }
+  assert(idx2.read(index,file) != 0);
+  assert(idx2.load(file) == 0 && idx2.nEvents() == n);
+  assert(idx2.read(index,file) == 0);
+
+					// no footer: events run to EOF
+  {
+    std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+    out << header << events[0] << events[1];
+  }
+  assert(idx.build(file) == 0 && idx.nEvents() == 2);
+  assert(idx.footer() == idx.fileSize());
+
+  remove(file.c_str());
+  remove(index.c_str());
+  remove(slice.c_str());
+  cout << "testLesEventIndex: " << n << " events OK" << endl;
+  return 0;
+}
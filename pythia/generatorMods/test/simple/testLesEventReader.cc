@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testLesEventReader.cc
+// Purpose: Checks LesEventReader on generated plain and gzip'd Les
+//          Houches files: every value of <init> and of each event comes
+//          through the UPINIT/UPEVNT hooks into /HEPRUP/ and /HEPEUP/,
+//          with a small and a large prefetch ring, starting at an
+//          indexed offset or skipping events, and a broken event is
+//          reported.
+//
+//   usage: testLesEventReader [nevents]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "generatorMods/LesEventReader.hh"
+#include "generatorMods/LesEventIndex.hh"
+
+using std::cout;
+using std::endl;
+
+					// the commons and Fortran readers
+					// of a real job
+LesHeprup heprup_;
+LesHepeup hepeup_;
+static int nRealUpevnt = 0;
+extern "C" void __real_upinit_() { heprup_.NPRUP = -1; }
+extern "C" void __real_upevnt_() { ++nRealUpevnt; }
+
+static double value(int event, int particle, int k)
+{
+  return 0.001*((event*37 + particle*11 + k*5) % 9973) - 3.;
+}
+
+static std::string lhe(int n, bool broken)
+{
+  std::ostringstream s;
+  s << "<LesHouchesEvents version=\"1.0\">\n<header>\n"
+    << std::string(100000,'#') << "\n"          // longer than a buffer
+    << "</header>\n<init>\n"
+    << " 2212 -2212 0.98D+03 0.98E+03 0 0 10042 10042 3 2\n"
+    << " 1.5E+01 2.0E-01 3.0E+01 661\n"
+    << " 2.5D+00 1.0D-02 4.0D+00 662\n"
+    << "</init>\n";
+  for ( int i=0; i<n; i++ ) {
+    int nup = 2 + i%7;
+    s << ( i%2 ? "<event>\n" : "  <event npLO=\" 1 \">\n" )
+      << nup << " " << 661+i%2 << " " << i+0.5 << " 91.1876 0.78E-02 0.118\n";
+    if ( broken && i == n/2 ) nup--;
+    for ( int k=0; k<nup; k++ ) {
+      s << " " << 21-k << " " << ( k < 2 ? -1 : 1 ) << " " << k/2 << " 0 "
+	<< 501+k << " " << 502+k;
+      s.precision(10);
+      for ( int j=0; j<5; j++ ) s << " " << value(i,k,j);
+      s << " 0. " << ( k%2 ? "-1." : "9." ) << "\n";
+    }
+    if ( i%3 == 0 ) s << "#pdf 21 21 0.1 0.2 91.\n<mgrwt>\n</mgrwt>\n";
+    s << "</event>\n";
+  }
+  s << "</LesHouchesEvents>\n";
+  return s.str();
+}
+
+static void writeFile(const std::string& name, const std::string& text,
+		      bool gzip)
+{
+  if ( gzip ) {
+    gzFile f = gzopen(name.c_str(),"wb");
+    assert(f && gzwrite(f,text.data(),text.size()) == int(text.size()));
+    gzclose(f);
+  }
+  else {
+    FILE* f = fopen(name.c_str(),"wb");
+    assert(f && fwrite(text.data(),1,text.size(),f) == text.size());
+    fclose(f);
+  }
+}
+
+					// all events from first on
+static void check(LesEventReader& r, int first, int n)
+{
+  r.activate();
+  __wrap_upinit_();
+  assert(LesEventReader::hooked());
+  assert(heprup_.IDBMUP[0] == 2212 && heprup_.IDBMUP[1] == -2212);
+  assert(heprup_.EBMUP[0] == 980. && heprup_.EBMUP[1] == 980.);
+  assert(heprup_.PDFSUP[1] == 10042 && heprup_.IDWTUP == 3);
+  assert(heprup_.NPRUP == 2 && heprup_.LPRUP[1] == 662);
+  assert(heprup_.XSECUP[0] == 15. && heprup_.XMAXUP[1] == 4.);
+  for ( int i=first; i<n; i++ ) {
+    __wrap_upevnt_();
+    assert(hepeup_.NUP == 2 + i%7 && hepeup_.IDPRUP == 661+i%2);
+    assert(hepeup_.XWGTUP == i+0.5 && hepeup_.SCALUP == 91.1876);
+    assert(hepeup_.AQCDUP == 0.118);
+    for ( int k=0; k<hepeup_.NUP; k++ ) {
+      assert(hepeup_.IDUP[k] == 21-k && hepeup_.ISTUP[k] == (k<2 ? -1 : 1));
+      assert(hepeup_.MOTHUP[k][0] == k/2 && hepeup_.ICOLUP[k][1] == 502+k);
+      for ( int j=0; j<5; j++ ) {
+	assert(std::fabs(hepeup_.PUP[k][j] - value(i,k,j)) < 1.e-9);
+      }
+      assert(hepeup_.SPINUP[k] == ( k%2 ? -1. : 9. ));
+    }
+  }
+  __wrap_upevnt_();
+  assert(hepeup_.NUP == 0);                     // end of file
+  assert(r.nRead() == n-first && r.error().empty());
+}
+
+int main(int argc, char* argv[])
+{
+  int n = ( argc > 1 ) ? atoi(argv[1]) : 2000;
+  if ( n < 10 ) n = 10;
+  const std::string plain = "testLesEventReader.lhe";
+  const std::string gz    = "testLesEventReader.lhe.gz";
+  std::string text = lhe(n,false);
+  writeFile(plain,text,false);
+  writeFile(gz   ,text,true);
+  assert(!LesEventReader::gzipped(plain) && LesEventReader::gzipped(gz));
+
+					// no reader: the Fortran ones
+  __wrap_upinit_();
+  __wrap_upevnt_();
+  assert(heprup_.NPRUP == -1 && nRealUpevnt == 1);
+  assert(!LesEventReader::hooked());
+
+  const int queue[] = { 1, 3, 500 };
+  for ( int q=0; q<3; q++ ) {
+    LesEventReader r;
+    assert(r.open(plain,queue[q]) == 0);
+    check(r,0,n);
+    assert(r.open(gz,queue[q]) == 0);
+    check(r,0,n);
+  }
+  {
+    LesEventReader r;
+    r.activate();
+    assert(LesEventReader::active() == &r);
+  }
+  assert(!LesEventReader::active());
+
+					// start in the middle
+  LesEventIndex index;
+  assert(index.build(plain) == 0 && index.nEvents() == n);
+  for ( int first=1; first<n; first += n/3 ) {
+    LesEventReader r;
+    assert(r.open(plain,10,0,index.offset(first)) == 0);
+    check(r,first,n);
+    assert(r.open(gz,10,first) == 0);
+    check(r,first,n);
+  }
+
+					// stops at a broken event
+  writeFile(gz,lhe(n,true),true);
+  {
+    LesEventReader r;
+    assert(r.open(gz,4) == 0);
+    LesEvent e;
+    int nread = 0;
+    while ( r.read(e) ) nread++;
+    assert(nread == n/2 && !r.error().empty());
+    assert(!r.read(e));
+  }
+  LesEventReader r;
+  assert(r.open("testLesEventReader.none",4) != 0);
+  writeFile(plain,"<LesHouchesEvents>\n<init>\n 1 2\n",false);
+  assert(r.open(plain,4) != 0);
+
+					// a long file through the ring
+  writeFile(gz,lhe(50000,false),true);
+  assert(r.open(gz,100) == 0);
+  LesEvent e;
+  int nread = 0;
+  while ( r.read(e) ) nread++;
+  assert(nread == 50000 && r.error().empty());
+  r.close();
+
+  remove(plain.c_str());
+  remove(gz.c_str());
+  cout << "testLesEventReader: " << n << " events OK" << endl;
+  return 0;
+}
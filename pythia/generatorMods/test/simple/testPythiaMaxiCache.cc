@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testPythiaMaxiCache.cc
+// Purpose: Checks PythiaMaxiCache: the key changes with any setting,
+//          entries appended to a file are read back bit for bit, the
+//          last record of a key wins, a missing file is an empty
+//          cache and a corrupted one is rejected.
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "generatorMods/PythiaMaxiCache.hh"
+
+using std::cout;
+using std::endl;
+
+static PythiaMaxiCache::Entry makeEntry(int nsub, double scale)
+{
+  PythiaMaxiCache::Entry e;
+  e.nRandom = 1234567L*nsub;
+  e.xsec0   = 0.;
+  for ( int i=0; i<nsub; i++ ) {
+    e.isub.push_back(11+7*i);
+    e.xsec.push_back(scale*exp(-0.37*i)/3.);
+    e.xsec0 += e.xsec.back();
+    for ( int j=0; j<PythiaMaxiCache::NCOEF; j++ ) {
+      e.coef.push_back(scale*sin(1.+i+0.1*j));
+    }
+  }
+  return e;
+}
+
+static bool same(const PythiaMaxiCache::Entry& a,
+		 const PythiaMaxiCache::Entry& b)
+{
+  return a.nRandom == b.nRandom && a.xsec0 == b.xsec0 &&
+         a.isub == b.isub && a.xsec == b.xsec && a.coef == b.coef;
+}
+
+int main()
+{
+  const char* file = "testPythiaMaxiCache.bin";
+  remove(file);
+					// keys
+  std::vector<double> pars;
+  for ( int i=0; i<1000; i++ ) pars.push_back(0.5*i);
+  unsigned long long k1 = PythiaMaxiCache::key(pars);
+  pars[517] += 1.e-12;
+  unsigned long long k2 = PythiaMaxiCache::key(pars);
+  assert( k1 != k2 );
+  pars[517] -= 1.e-12;
+  assert( PythiaMaxiCache::key(pars) == k1 );
+  const char text[] = "BLOCK MASS";
+  assert( PythiaMaxiCache::key(text,10,k1) != k1 );
+
+					// missing file, append, read back
+  PythiaMaxiCache cache;
+  assert( cache.read(file) == 0 && cache.size() == 0 );
+  PythiaMaxiCache::Entry e1 = makeEntry(40,1.e-3);
+  PythiaMaxiCache::Entry e2 = makeEntry(3,7.);
+  PythiaMaxiCache::Entry e3 = makeEntry(5,2.);
+  assert( cache.append(file,k1,e1) == 0 );
+  assert( cache.append(file,k2,e2) == 0 );
+  assert( cache.find(k1) && same(*cache.find(k1),e1) );
+
+  PythiaMaxiCache back;
+  assert( back.read(file) == 0 && back.size() == 2 );
+  assert( same(*back.find(k1),e1) && same(*back.find(k2),e2) );
+  assert( back.find(k1^1) == 0 );
+					// the last record of a key wins
+  assert( back.append(file,k2,e3) == 0 );
+  assert( cache.read(file) == 0 && cache.size() == 2 );
+  assert( same(*cache.find(k2),e3) );
+
+					// corrupted file
+  FILE* f = fopen(file,"ab");
+  fwrite("GARBAGE!",1,8,f);
+  fclose(f);
+  assert( cache.read(file) != 0 && cache.size() == 0 );
+  remove(file);
+
+  cout << "testPythiaMaxiCache: OK" << endl;
+  return 0;
+}
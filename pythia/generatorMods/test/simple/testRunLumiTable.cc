@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////
+//
+// File: testRunLumiTable.cc
+// Purpose: Checks RunLumiTable on the checked-in sample table: sorting
+//          and merging, the text -> binary round trip, the cumulative
+//          search at the bin edges and the sampled run frequencies.
+//
+//   usage: testRunLumiTable [table]
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <map>
+
+#include "CLHEP/Random/JamesRandom.h"
+#include "generatorMods/RunLumiTable.hh"
+
+using std::cout;
+using std::endl;
+
+int main(int argc, char* argv[])
+{
+  const char* file = ( argc > 1 ) ? argv[1] 
+    : "generatorMods/test/simple/runLumiSample.txt";
+
+  RunLumiTable table;
+  assert( table.read(file) == 0 );
+					// 10 rows, one duplicate, one zero
+  assert( table.size() == 8 );
+  for ( int i=1; i<table.size(); i++ ) assert( table.run(i-1) < table.run(i) );
+  assert( table.run(0) == 138425 );
+  assert( fabs(table.lumi(table.size()-1) - 60.) < 1.e-9 );
+  assert( fabs(table.totalLumi() - 1024.6) < 1.e-9 );
+
+					// run range selection
+  RunLumiTable part;
+  assert( part.read(file,140000,150000) == 0 );
+  assert( part.size() == 4 && part.run(0) == 141544 );
+
+					// binary round trip
+  const char* bin = "testRunLumiTable.bin";
+  assert( table.write(bin) == 0 );
+  RunLumiTable copy;
+  assert( copy.read(bin) == 0 );
+  assert( copy.size() == table.size() );
+  for ( int i=0; i<table.size(); i++ ) {
+    assert( copy.run(i) == table.run(i) );
+    assert( copy.lumi(i) == table.lumi(i) );
+  }
+  remove(bin);
+
+					// bin edges
+  assert( table.find(0.) == table.run(0) );
+  assert( table.find(1.) == table.run(table.size()-1) );
+  double edge = table.lumi(0)/table.totalLumi();
+  assert( table.find(edge*0.999) == table.run(0) );
+  assert( table.find(edge*1.001) == table.run(1) );
+
+					// sampled frequencies
+  HepJamesRandom engine(12345);
+  std::map<int,long> count;
+  const long n = 1000000;
+  for ( long i=0; i<n; i++ ) count[table.shoot(&engine)]++;
+  assert( int(count.size()) == table.size() );
+  for ( int i=0; i<table.size(); i++ ) {
+    double p = table.lumi(i)/table.totalLumi();
+    double f = double(count[table.run(i)])/n;
+    assert( fabs(f-p) < 5.*sqrt(p*(1.-p)/n) );
+  }
+
+  cout << "testRunLumiTable: OK, " << table.size() << " runs" << endl;
+  return 0;
+}